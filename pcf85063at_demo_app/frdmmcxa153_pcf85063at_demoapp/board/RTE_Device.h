@@ -23,7 +23,10 @@ extern void LPUART0_InitPins_deinit();
 /* User needs to provide the implementation of LPI2CX_GetFreq/LPI2CX_InitPins/LPI2CX_DeinitPins for the enabled LPI2C
  * instance. */
 #define RTE_I2C0        1
+/* RTE_I2C0_DMA_EN - 1 for EDMA Mode, 0 - for Interrupt Mode, may be set by the project. */
+#ifndef RTE_I2C0_DMA_EN
 #define RTE_I2C0_DMA_EN 0
+#endif
 
 /* LPI2C configuration. */
 #define RTE_I2C0_PIN_INIT        LPI2C0_InitPins
@@ -18,4 +18,8 @@
 
 #define PCF85063AT_I2C_ADDR 0x51
 
+// I2C pins of the RTC, as GPIO for the bus recovery
+#define PCF85063AT_SCL      D19
+#define PCF85063AT_SDA      D18
+
 #endif /* _FRDM_PCF85063AT_SHIELD_H_ */
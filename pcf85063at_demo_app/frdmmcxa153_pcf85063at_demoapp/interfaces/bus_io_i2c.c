@@ -0,0 +1,271 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bus_io_i2c.c
+ * @brief The bus_io_i2c.c file implements the per-bus transaction queue on top of the
+ *  asynchronous register I/O interface.
+ */
+
+/* Standard C Includes */
+#include <string.h>
+
+/* ISSDK Includes */
+#include "issdk_hal.h"
+#include "systick_utils.h"
+#include "bus_io_i2c.h"
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+typedef struct
+{
+    busTransaction_t *volatile pHead;   /* Queued transactions, sorted by priority. */
+    busTransaction_t *volatile pActive; /* Transaction on the wire. */
+    volatile bool retry;                /* The bus was freed while pActive was being started. */
+    busStats_t stats;
+} busQueue_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static busQueue_t g_BusQueue[BUS_I2C_MAX_INSTANCES];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void Bus_I2C_Done(void *pUserData, int32_t status);
+
+/* Start queued transactions until one is on the wire, the queue is empty or the bus is owned by another caller. */
+static void Bus_I2C_StartNext(busQueue_t *pQueue)
+{
+    busTransaction_t *pTransaction;
+    uint32_t primask, wait;
+    int32_t status;
+
+    for (;;)
+    {
+        primask = DisableGlobalIRQ();
+        pTransaction = pQueue->pHead;
+        if (pQueue->pActive != NULL)
+        {
+            /*! Being started from a lower context, which retries if its start finds the bus owned. */
+            pQueue->retry = true;
+        }
+        if ((pQueue->pActive != NULL) || (pTransaction == NULL))
+        {
+            EnableGlobalIRQ(primask);
+            return;
+        }
+        pQueue->pHead = pTransaction->pNext;
+        pQueue->pActive = pTransaction;
+        pQueue->retry = false;
+        pQueue->stats.queueDepth--;
+        EnableGlobalIRQ(primask);
+
+        if (pTransaction->type == BUS_I2C_READ)
+        {
+            status = Register_I2C_ReadAsync(pTransaction->pCommDrv, pTransaction->devInfo, pTransaction->slaveAddress,
+                                            pTransaction->offset, pTransaction->length, pTransaction->pBuffer,
+                                            &pTransaction->xfer, Bus_I2C_Done, pTransaction);
+        }
+        else
+        {
+            status = Register_I2C_BlockWriteAsync(pTransaction->pCommDrv, pTransaction->devInfo,
+                                                  pTransaction->slaveAddress, pTransaction->offset,
+                                                  pTransaction->pBuffer, pTransaction->length, &pTransaction->xfer,
+                                                  Bus_I2C_Done, pTransaction);
+        }
+        if (ARM_DRIVER_OK == status)
+        {
+            wait = pTransaction->xfer.startTick - pTransaction->submitTick;
+            pQueue->stats.totalWaitTicks += wait;
+            if (wait > pQueue->stats.maxWaitTicks)
+            {
+                pQueue->stats.maxWaitTicks = wait;
+            }
+            return;
+        }
+        if (ARM_DRIVER_ERROR_BUSY == status)
+        {
+            /*! A blocking call or a transfer outside the queue owns the bus, back to the head of the queue until
+             *  it frees the bus. */
+            primask = DisableGlobalIRQ();
+            pTransaction->pNext = pQueue->pHead;
+            pQueue->pHead = pTransaction;
+            pQueue->pActive = NULL;
+            pQueue->stats.queueDepth++;
+            if (!pQueue->retry)
+            {
+                EnableGlobalIRQ(primask);
+                return;
+            }
+            EnableGlobalIRQ(primask);
+            continue;
+        }
+
+        /*! Could not be started, complete it with the error and move on. */
+        pQueue->stats.failed++;
+        pQueue->pActive = NULL;
+        if (pTransaction->callback)
+        {
+            pTransaction->callback(pTransaction->pUserData, status);
+        }
+    }
+}
+
+/* Completion of the transaction on the wire, runs in the I2C interrupt context. */
+static void Bus_I2C_Done(void *pUserData, int32_t status)
+{
+    busTransaction_t *pTransaction = (busTransaction_t *)pUserData;
+    busQueue_t *pQueue = &g_BusQueue[pTransaction->devInfo->deviceInstance];
+
+    if (ARM_DRIVER_OK == status)
+    {
+        pQueue->stats.completed++;
+    }
+    else
+    {
+        pQueue->stats.failed++;
+        if (ARM_DRIVER_ERROR_TIMEOUT == status)
+        {
+            pQueue->stats.timeouts++;
+        }
+    }
+    pQueue->pActive = NULL;
+    if (pTransaction->callback)
+    {
+        pTransaction->callback(pTransaction->pUserData, status);
+    }
+    /*! The next transaction starts back to back from Bus_I2C_BusFree(), once the register interface has
+     *  released the bus. */
+}
+
+/* Called by the register interface each time the bus is released, starts the next queued transaction. */
+static void Bus_I2C_BusFree(void *pParam)
+{
+    Bus_I2C_StartNext((busQueue_t *)pParam);
+}
+
+/*! Recover the bus when the transaction on the wire is past its deadline. */
+int32_t Bus_I2C_Poll(uint8_t deviceInstance)
+{
+    busTransaction_t *pTransaction;
+    uint32_t primask;
+
+    if (deviceInstance >= BUS_I2C_MAX_INSTANCES)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    primask = DisableGlobalIRQ();
+    pTransaction = g_BusQueue[deviceInstance].pActive;
+    EnableGlobalIRQ(primask);
+    if (pTransaction == NULL)
+    {
+        return ARM_DRIVER_OK;
+    }
+
+    return Register_I2C_CheckDeadline(pTransaction->pCommDrv, pTransaction->devInfo);
+}
+
+/*! Queue a register transaction on its bus. */
+int32_t Bus_I2C_Submit(busTransaction_t *pTransaction)
+{
+    busQueue_t *pQueue;
+    busTransaction_t *volatile *ppLink;
+    uint32_t primask;
+
+    if ((pTransaction == NULL) || (pTransaction->devInfo == NULL) || (pTransaction->pCommDrv == NULL) ||
+        (pTransaction->devInfo->deviceInstance >= BUS_I2C_MAX_INSTANCES) || (pTransaction->pBuffer == NULL) ||
+        ((pTransaction->type == BUS_I2C_WRITE) && (pTransaction->length >= REGISTER_ASYNC_BUFFER_SIZE)))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    pQueue = &g_BusQueue[pTransaction->devInfo->deviceInstance];
+    /*! Set on each submit, Register_I2C_Initialize() clears it. */
+    if (Register_I2C_SetBusFree(pTransaction->devInfo->deviceInstance, Bus_I2C_BusFree, pQueue) != ARM_DRIVER_OK)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    (void)Bus_I2C_Poll(pTransaction->devInfo->deviceInstance);
+
+    pTransaction->xfer.state = REGISTER_ASYNC_IDLE;
+    pTransaction->submitTick = BOARD_SystickGetTicks();
+
+    primask = DisableGlobalIRQ();
+    /*! Behind every transaction of the same or a higher priority, FIFO within a priority. */
+    for (ppLink = &pQueue->pHead; *ppLink != NULL; ppLink = &(*ppLink)->pNext)
+    {
+        if ((*ppLink)->priority > pTransaction->priority)
+        {
+            break;
+        }
+    }
+    pTransaction->pNext = *ppLink;
+    *ppLink = pTransaction;
+
+    pQueue->stats.submitted++;
+    pQueue->stats.queueDepth++;
+    if (pQueue->stats.queueDepth > pQueue->stats.maxQueueDepth)
+    {
+        pQueue->stats.maxQueueDepth = pQueue->stats.queueDepth;
+    }
+    EnableGlobalIRQ(primask);
+
+    Bus_I2C_StartNext(pQueue);
+
+    return ARM_DRIVER_OK;
+}
+
+/*! Tell whether a bus has transactions queued or in flight. */
+bool Bus_I2C_IsBusy(uint8_t deviceInstance)
+{
+    if (deviceInstance >= BUS_I2C_MAX_INSTANCES)
+    {
+        return false;
+    }
+    (void)Bus_I2C_Poll(deviceInstance);
+
+    return (g_BusQueue[deviceInstance].pActive != NULL) || (g_BusQueue[deviceInstance].pHead != NULL);
+}
+
+/*! Get the statistics of a bus. */
+int32_t Bus_I2C_GetStats(uint8_t deviceInstance, busStats_t *pStats)
+{
+    uint32_t primask;
+
+    if ((deviceInstance >= BUS_I2C_MAX_INSTANCES) || (pStats == NULL))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    primask = DisableGlobalIRQ();
+    *pStats = g_BusQueue[deviceInstance].stats;
+    EnableGlobalIRQ(primask);
+
+    return ARM_DRIVER_OK;
+}
+
+/*! Clear the statistics of a bus. */
+void Bus_I2C_ResetStats(uint8_t deviceInstance)
+{
+    uint32_t primask;
+    uint16_t queueDepth;
+
+    if (deviceInstance >= BUS_I2C_MAX_INSTANCES)
+    {
+        return;
+    }
+
+    primask = DisableGlobalIRQ();
+    queueDepth = g_BusQueue[deviceInstance].stats.queueDepth;
+    memset(&g_BusQueue[deviceInstance].stats, 0, sizeof(busStats_t));
+    g_BusQueue[deviceInstance].stats.queueDepth = queueDepth;
+    g_BusQueue[deviceInstance].stats.maxQueueDepth = queueDepth;
+    EnableGlobalIRQ(primask);
+}
@@ -18,11 +18,14 @@
 /* ISSDK Includes */
 #include "issdk_hal.h"
 #include "register_io_i2c.h"
+#include "systick_utils.h"
 
 /*******************************************************************************
  * Types
  ******************************************************************************/
 #define I2C_COUNT (sizeof(i2cBases) / sizeof(void *))
+/*! Shortest wait worth a sleep, closer to the deadline the sleeping wait modes spin. */
+#define REGISTER_SLEEP_MIN_US (10U)
 
 /*******************************************************************************
  * Variables
@@ -32,352 +35,1291 @@ LPI2C_Type *const i2cBases[] = LPI2C_BASE_PTRS;
 #else
 I2C_Type *const i2cBases[] = I2C_BASE_PTRS;
 #endif
-volatile bool b_I2C_CompletionFlag[I2C_COUNT] = {false};
-volatile uint32_t g_I2C_ErrorEvent[I2C_COUNT] = {ARM_I2C_EVENT_TRANSFER_DONE};
+/*! I/O contexts bound by Register_I2C_Initialize(), NULL for the built-in context of the bus. */
+static registerIoContext_t *g_I2C_Context[I2C_COUNT];
+static registerIoContext_t s_defaultContext[I2C_COUNT];
+static const registerRetryPolicy_t s_defaultRetryPolicy[REGISTER_ERROR_CLASS_COUNT] = REGISTER_RETRY_POLICY_DEFAULT;
 
 /*******************************************************************************
  * Code
  ******************************************************************************/
 
-#if defined(I2C0)
-/* The I2C0 Signal Event Handler function. */
-void I2C0_SignalEvent_t(uint32_t event)
+/* Get the I/O context of an I2C instance. */
+static inline registerIoContext_t *Register_I2C_Context(uint32_t instance)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
-    {
-        g_I2C_ErrorEvent[0] = event;
-    }
-    b_I2C_CompletionFlag[0] = true;
+    registerIoContext_t *pContext = g_I2C_Context[instance];
+
+    return pContext ? pContext : &s_defaultContext[instance];
 }
-#endif
 
-#if defined(I2C1)
-/* The I2C1 Signal Event Handler function. */
-void I2C1_SignalEvent_t(uint32_t event)
+#if REGISTER_IO_STATS
+/*! Count a transfer started on the bus. */
+#define REGISTER_IO_COUNT_TRANSFER(devInfo, written, read) \
+    do                                                     \
+    {                                                      \
+        (devInfo)->stats.transactions++;                   \
+        (devInfo)->stats.bytesWritten += (written);        \
+        (devInfo)->stats.bytesRead += (read);              \
+    } while (0)
+
+/* Count the errors reported by the events of a transfer. */
+static void Register_I2C_CountEvent(registerDeviceInfo_t *devInfo, uint32_t event)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
+    if (event & ARM_I2C_EVENT_ADDRESS_NACK)
+    {
+        devInfo->stats.nacks++;
+    }
+    if (event & ARM_I2C_EVENT_ARBITRATION_LOST)
+    {
+        devInfo->stats.arbitrationLost++;
+    }
+    if (event & ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
     {
-        g_I2C_ErrorEvent[1] = event;
+        devInfo->stats.incomplete++;
     }
-    b_I2C_CompletionFlag[1] = true;
 }
+#else
+#define REGISTER_IO_COUNT_TRANSFER(devInfo, written, read)
 #endif
 
-#if defined(I2C2)
-/* The I2C2 Signal Event Handler function. */
-void I2C2_SignalEvent_t(uint32_t event)
+/* Classify the events of a failed transfer. */
+static int32_t Register_I2C_Classify(uint32_t event)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
+    if (event & ARM_I2C_EVENT_ADDRESS_NACK)
+    {
+        return REGISTER_ERROR_ADDRESS_NACK;
+    }
+    if (event & ARM_I2C_EVENT_ARBITRATION_LOST)
     {
-        g_I2C_ErrorEvent[2] = event;
+        return REGISTER_ERROR_ARBITRATION_LOST;
     }
-    b_I2C_CompletionFlag[2] = true;
+    if (event & ARM_I2C_EVENT_BUS_ERROR)
+    {
+        return REGISTER_ERROR_BUS_ERROR;
+    }
+    /*! A device not acknowledging a data byte ends the transfer, which is then done with less data. */
+    if ((event & (ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE)) ==
+        (ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE))
+    {
+        return REGISTER_ERROR_DATA_NACK;
+    }
+
+    return REGISTER_ERROR_INCOMPLETE;
 }
-#endif
 
-#if defined(I2C3)
-/* The I2C3 Signal Event Handler function. */
-void I2C3_SignalEvent_t(uint32_t event)
+/* Select the driver of a register transfer and count it. */
+static ARM_DRIVER_I2C *Register_I2C_Transport(ARM_DRIVER_I2C *pCommDrv,
+                                              registerDeviceInfo_t *devInfo,
+                                              uint32_t dataBytes)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
+    ARM_DRIVER_I2C *pDrv = Register_I2C_SelectTransport(pCommDrv, devInfo->deviceInstance, dataBytes);
+
+#if REGISTER_IO_STATS
+    if (pDrv != pCommDrv)
     {
-        g_I2C_ErrorEvent[3] = event;
+        devInfo->stats.dmaTransactions++;
     }
-    b_I2C_CompletionFlag[3] = true;
-}
 #endif
 
-#if defined(I2C4)
-/* The I2C4 Signal Event Handler function. */
-void I2C4_SignalEvent_t(uint32_t event)
+    return pDrv;
+}
+
+/* Call the idle function of a device, spin without one. */
+static void Register_I2C_Yield(registerDeviceInfo_t *devInfo)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
+    if (devInfo->idleFunction)
+    {
+        devInfo->idleFunction(devInfo->functionParam);
+    }
+    else
     {
-        g_I2C_ErrorEvent[4] = event;
+        __NOP();
     }
-    b_I2C_CompletionFlag[4] = true;
 }
-#endif
 
-#if defined(I2C5)
-/* The I2C5 Signal Event Handler function. */
-void I2C5_SignalEvent_t(uint32_t event)
+/* Tell whether a blocking transfer is over, pXfer is NULL for the transfers signalled by the completion flag. */
+static bool Register_I2C_Done(registerDeviceInfo_t *devInfo, const registerAsyncTransfer_t *pXfer)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
+    if (pXfer != NULL)
     {
-        g_I2C_ErrorEvent[5] = event;
+        return pXfer->state == REGISTER_ASYNC_IDLE;
     }
-    b_I2C_CompletionFlag[5] = true;
+
+    return Register_I2C_Context(devInfo->deviceInstance)->completionFlag;
 }
-#endif
 
-#if defined(I2C6)
-/* The I2C6 Signal Event Handler function. */
-void I2C6_SignalEvent_t(uint32_t event)
+/* Convert microseconds to SysTick ticks. */
+static uint32_t Register_I2C_Ticks(uint32_t us)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
+    return us * (CLOCK_GetFreq(kCLOCK_CoreSysClk) / 1000000U);
+}
+
+/* Get the longest wait for one transfer of a device, in SysTick ticks. */
+static uint32_t Register_I2C_Timeout(registerDeviceInfo_t *devInfo)
+{
+    return Register_I2C_Ticks(devInfo->timeoutUs ? devInfo->timeoutUs : REGISTER_IO_TIMEOUT_US);
+}
+
+/* Tell whether a wait started at start has run for timeout ticks, across one wrap of the SysTick count. */
+static bool Register_I2C_Expired(uint32_t start, uint32_t timeout)
+{
+    return (BOARD_SystickGetTicks() - start) >= timeout;
+}
+
+/* Arm the SysTick interrupt at the deadline of a wait started at start for timeout ticks: a transfer which
+ * never ends raises no other interrupt. Tell whether the core may sleep, false when the deadline is too close
+ * or no wake-up can be armed before it. */
+static bool Register_I2C_ArmWakeup(uint32_t start, uint32_t timeout)
+{
+    uint32_t elapsed = BOARD_SystickGetTicks() - start;
+    uint32_t remaining;
+
+    if (elapsed >= timeout)
+    {
+        return false;
+    }
+    remaining = timeout - elapsed;
+    if (remaining < Register_I2C_Ticks(REGISTER_SLEEP_MIN_US))
     {
-        g_I2C_ErrorEvent[6] = event;
+        return false;
     }
-    b_I2C_CompletionFlag[6] = true;
+
+    /*! Beyond one SysTick period the wrap comes first. */
+    return BOARD_SystickSetWakeup(remaining) || (BOARD_SystickGetTicksToWrap() < remaining);
 }
-#endif
 
-#if defined(I2C7)
-/* The I2C7 Signal Event Handler function. */
-void I2C7_SignalEvent_t(uint32_t event)
+/* Run one pass of a wait loop started at start for timeout ticks, in the wait mode of the device. */
+static void Register_I2C_Idle(registerDeviceInfo_t *devInfo,
+                              const registerAsyncTransfer_t *pXfer,
+                              uint32_t start,
+                              uint32_t timeout)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
+    uint32_t primask;
+    uint32_t waitMode = devInfo->waitMode;
+#if REGISTER_IO_STATS
+    uint32_t passStart = BOARD_SystickGetTicks();
+#endif
+
+    /*! A sleeping wait mode which cannot wake up by the deadline spins, and is counted so. */
+    if (((waitMode == REGISTER_WAIT_WFE) || (waitMode == REGISTER_WAIT_WFI)) && !Register_I2C_ArmWakeup(start, timeout))
     {
-        g_I2C_ErrorEvent[7] = event;
+        waitMode = REGISTER_WAIT_SPIN;
+    }
+
+    switch (waitMode)
+    {
+        case REGISTER_WAIT_SPIN:
+            __NOP();
+            break;
+        case REGISTER_WAIT_WFE:
+            /*! An event sent since the completion check ends the WFE at once. */
+            __WFE();
+            break;
+        case REGISTER_WAIT_WFI:
+            /*! Masked, the completion interrupt cannot run between the check and the sleep. It still ends the
+             *  WFI when pending and is taken once unmasked. */
+            primask = DisableGlobalIRQ();
+            if (!Register_I2C_Done(devInfo, pXfer))
+            {
+                __DSB();
+                __WFI();
+            }
+            EnableGlobalIRQ(primask);
+            break;
+        default:
+            Register_I2C_Yield(devInfo);
+            waitMode = REGISTER_WAIT_YIELD;
+            break;
     }
-    b_I2C_CompletionFlag[7] = true;
+#if REGISTER_IO_STATS
+    devInfo->stats.waitCycles[waitMode] += BOARD_SystickGetTicks() - passStart;
+#endif
 }
+
+/* Count a timeout and recover the bus. */
+static void Register_I2C_TimedOut(ARM_DRIVER_I2C *pCommDrv, registerDeviceInfo_t *devInfo)
+{
+#if REGISTER_IO_STATS
+    devInfo->stats.timeouts++;
 #endif
+    (void)Register_I2C_Recover(pCommDrv, devInfo);
+}
 
-#ifdef MIMXRT500_AGM01
-#if defined(I2C11)
-/* The I2C11 Signal Event Handler function. */
-void I2C11_SignalEvent_t(uint32_t event)
+#if REGISTER_IO_STATS
+/* Count the passes of a wait loop, Register_I2C_Idle() counts their time. */
+static void Register_I2C_CountWait(registerDeviceInfo_t *devInfo, uint32_t iterations)
 {
-    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
+    devInfo->stats.waitIterations += iterations;
+    if (iterations > devInfo->stats.maxWaitIterations)
     {
-        g_I2C_ErrorEvent[11] = event;
+        devInfo->stats.maxWaitIterations = iterations;
     }
-    b_I2C_CompletionFlag[11] = true;
 }
 #endif
-#endif
 
-/*! The interface function to block write sensor registers. */
-int32_t Register_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
-                                registerDeviceInfo_t *devInfo,
-                                uint16_t slaveAddress,
-                                uint8_t offset,
-                                const uint8_t *pBuffer,
-                                uint8_t bytesToWrite)
+/* Wait for the completion of a blocking transfer, abort it when incomplete. */
+static int32_t Register_I2C_Wait(ARM_DRIVER_I2C *pCommDrv, registerDeviceInfo_t *devInfo)
 {
-    int32_t status;
-    uint8_t buffer[SENSOR_MAX_REGISTER_COUNT];
-
-    buffer[0] = offset;
-    memcpy(buffer + 1, pBuffer, bytesToWrite);
+    registerIoContext_t *pContext = Register_I2C_Context(devInfo->deviceInstance);
+    uint32_t start = BOARD_SystickGetTicks();
+    uint32_t timeout = Register_I2C_Timeout(devInfo);
+#if REGISTER_IO_STATS
+    uint32_t iterations = 0;
+#endif
 
-    b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
-    g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
-    status = pCommDrv->MasterTransmit(slaveAddress, buffer, bytesToWrite + 1, false);
-    if (ARM_DRIVER_OK == status)
+    while (!pContext->completionFlag)
     {
-        /* Wait for completion */
-        while (!b_I2C_CompletionFlag[devInfo->deviceInstance])
-        {
-            if (devInfo->idleFunction)
-            {
-                devInfo->idleFunction(devInfo->functionParam);
-            }
-            else
-            {
-                __NOP();
-            }
-        }
-        if (g_I2C_ErrorEvent[devInfo->deviceInstance] == ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
+        /*! The flag is checked again, the transfer may have completed while the deadline passed. */
+        if (Register_I2C_Expired(start, timeout) && !pContext->completionFlag)
         {
-            pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
-        }
-        if (g_I2C_ErrorEvent[devInfo->deviceInstance] != ARM_I2C_EVENT_TRANSFER_DONE)
-        {
-            status = ARM_DRIVER_ERROR;
+#if REGISTER_IO_STATS
+            Register_I2C_CountWait(devInfo, iterations);
+#endif
+            Register_I2C_TimedOut(pCommDrv, devInfo);
+            return ARM_DRIVER_ERROR_TIMEOUT;
         }
+        Register_I2C_Idle(devInfo, NULL, start, timeout);
+#if REGISTER_IO_STATS
+        iterations++;
+#endif
+    }
+#if REGISTER_IO_STATS
+    Register_I2C_CountWait(devInfo, iterations);
+    Register_I2C_CountEvent(devInfo, pContext->errorEvent);
+#endif
+    if (pContext->errorEvent == ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
+    {
+        pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
+#if REGISTER_IO_STATS
+        devInfo->stats.aborts++;
+#endif
+    }
+    if (pContext->errorEvent != ARM_I2C_EVENT_TRANSFER_DONE)
+    {
+        return Register_I2C_Classify(pContext->errorEvent);
     }
 
-    return status;
+    return ARM_DRIVER_OK;
 }
 
-/*! The interface function to write a sensor register. */
-int32_t Register_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
-                           registerDeviceInfo_t *devInfo,
-                           uint16_t slaveAddress,
-                           uint8_t offset,
-                           uint8_t value,
-                           uint8_t mask,
-                           bool repeatedStart)
+/* Advance the asynchronous transfer pending on a bus, called from the Signal Event Handler. */
+static void Register_I2C_AsyncStep(registerIoContext_t *pContext, uint32_t event)
 {
-    int32_t status;
-    uint8_t config[] = {offset, 0x00};
+    registerAsyncTransfer_t *pXfer = pContext->pAsyncTransfer;
+    registerasynccallback_t callback;
+    void *pUserData;
+    int32_t status = ARM_DRIVER_OK;
 
-    /*! Set the register based on the values in the register value pair configuration.*/
-    if (mask)
+    if (event != ARM_I2C_EVENT_TRANSFER_DONE)
     {
-        b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
-        g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
-        /*! Send the register address to read from.*/
-        status = pCommDrv->MasterTransmit(slaveAddress, &config[0], 1, true);
-        if (ARM_DRIVER_OK == status)
-        {
-            /* Wait for completion without calling idle function */
-            while (!b_I2C_CompletionFlag[devInfo->deviceInstance])
-            {
-                if (devInfo->idleFunction)
-                {
-                    devInfo->idleFunction(devInfo->functionParam);
-                }
-                else
-                {
-                    __NOP();
-                }
-            };
-            if (g_I2C_ErrorEvent[devInfo->deviceInstance] == ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
-            {
-                pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
-            }
-            if (g_I2C_ErrorEvent[devInfo->deviceInstance] != ARM_I2C_EVENT_TRANSFER_DONE)
-            {
-                return ARM_DRIVER_ERROR;
-            }
-        }
-        else
+#if REGISTER_IO_STATS
+        Register_I2C_CountEvent(pXfer->devInfo, event);
+#endif
+        if (event & ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
         {
-            return status;
+            pXfer->pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
+#if REGISTER_IO_STATS
+            pXfer->devInfo->stats.aborts++;
+#endif
         }
-        b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
-        g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
-        /*! Read the value.*/
-        status = pCommDrv->MasterReceive(slaveAddress, &config[1], 1, false);
+        status = Register_I2C_Classify(event);
+    }
+    else if (pXfer->state == REGISTER_ASYNC_ADDRESS)
+    {
+        /*! Register address sent, chain the data phase from the interrupt context. */
+        pXfer->state = REGISTER_ASYNC_DATA;
+        status = pXfer->pCommDrv->MasterReceive(pXfer->slaveAddress, pXfer->pBuffer, pXfer->length, false);
         if (ARM_DRIVER_OK == status)
         {
-            /* Wait for completion */
-            while (!b_I2C_CompletionFlag[devInfo->deviceInstance])
-            {
-                if (devInfo->idleFunction)
-                {
-                    devInfo->idleFunction(devInfo->functionParam);
-                }
-                else
-                {
-                    __NOP();
-                }
-            }
-            if (g_I2C_ErrorEvent[devInfo->deviceInstance] == ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
-            {
-                pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
-            }
-            if (g_I2C_ErrorEvent[devInfo->deviceInstance] != ARM_I2C_EVENT_TRANSFER_DONE)
-            {
-                return ARM_DRIVER_ERROR;
-            }
-        }
-        else
-        {
-            return status;
+            REGISTER_IO_COUNT_TRANSFER(pXfer->devInfo, 0, pXfer->length);
+            return;
         }
-        /*! 'OR' in the requested values to the current contents of the register */
-        config[1] = (config[1] & ~mask) | value;
     }
-    else
+
+    /*! Release the bus before the callback so that it can start the next transfer. A blocking caller may
+     *  return as soon as the state is idle, the descriptor is not touched after that. */
+    callback = pXfer->callback;
+    pUserData = pXfer->pUserData;
+    pContext->pAsyncTransfer = NULL;
+    pXfer->status = status;
+    pXfer->state = REGISTER_ASYNC_IDLE;
+    if (callback)
     {
-        /*! Overwrite the register with specified value.*/
-        config[1] = value;
+        callback(pUserData, status);
     }
-
-    b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
-    g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
-    /*!  Write the updated value. */
-    status = pCommDrv->MasterTransmit(slaveAddress, config, sizeof(config), repeatedStart);
-    if (ARM_DRIVER_OK == status)
+    /*! Unless the callback started another transfer. */
+    if ((pContext->busFree != NULL) && (pContext->pAsyncTransfer == NULL))
     {
-        /* Wait for completion */
-        while (!b_I2C_CompletionFlag[devInfo->deviceInstance])
-        {
-            if (devInfo->idleFunction)
-            {
-                devInfo->idleFunction(devInfo->functionParam);
-            }
-            else
-            {
-                __NOP();
-            }
-        }
-        if (g_I2C_ErrorEvent[devInfo->deviceInstance] == ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
-        {
-            pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
-        }
-        if (g_I2C_ErrorEvent[devInfo->deviceInstance] != ARM_I2C_EVENT_TRANSFER_DONE)
-        {
-            status = ARM_DRIVER_ERROR;
-        }
+        pContext->busFree(pContext->pBusFreeParam);
     }
-
-    return status;
 }
 
-/*! The interface function to read a sensor register. */
-int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
-                          registerDeviceInfo_t *devInfo,
-                          uint16_t slaveAddress,
-                          uint8_t offset,
-                          uint8_t length,
-                          uint8_t *pOutBuffer)
+/* The Signal Event Handler shared by all I2C instances. */
+static void Register_I2C_SignalEvent(uint32_t instance, uint32_t event)
 {
-    int32_t status;
+    registerIoContext_t *pContext = Register_I2C_Context(instance);
 
-    b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
-    g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
-    status = pCommDrv->MasterTransmit(slaveAddress, &offset, 1, true);
-    if (ARM_DRIVER_OK == status)
+    if (pContext->pAsyncTransfer != NULL)
     {
-        /* Wait for completion without calling idle function. */
-        while (!b_I2C_CompletionFlag[devInfo->deviceInstance])
-        {
-            if (devInfo->idleFunction)
-            {
-                devInfo->idleFunction(devInfo->functionParam);
-            }
-            else
-            {
-                __NOP();
-            }
-        };
-        if (g_I2C_ErrorEvent[devInfo->deviceInstance] == ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
-        {
-            pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
-        }
-        if (g_I2C_ErrorEvent[devInfo->deviceInstance] != ARM_I2C_EVENT_TRANSFER_DONE)
-        {
-            return ARM_DRIVER_ERROR;
-        }
+        Register_I2C_AsyncStep(pContext, event);
     }
     else
     {
-        return status;
-    }
-
-    b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
-    g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
-    /*! Read and update the value.*/
-    status = pCommDrv->MasterReceive(slaveAddress, pOutBuffer, length, false);
-    if (ARM_DRIVER_OK == status)
-    {
-        /* Wait for completion */
-        while (!b_I2C_CompletionFlag[devInfo->deviceInstance])
-        {
-            if (devInfo->idleFunction)
-            {
-                devInfo->idleFunction(devInfo->functionParam);
-            }
-            else
-            {
-                __NOP();
-            }
-        }
-        if (g_I2C_ErrorEvent[devInfo->deviceInstance] == ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
-        {
-            pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
-        }
-        if (g_I2C_ErrorEvent[devInfo->deviceInstance] != ARM_I2C_EVENT_TRANSFER_DONE)
+        if (event != ARM_I2C_EVENT_TRANSFER_DONE)
         {
-            status = ARM_DRIVER_ERROR;
+            pContext->errorEvent = event;
         }
+        pContext->completionFlag = true;
     }
+    /*! Wake a REGISTER_WAIT_WFE wait. */
+    __SEV();
+}
 
-    return status;
+#if defined(I2C0)
+/* The I2C0 Signal Event Handler function. */
+void I2C0_SignalEvent_t(uint32_t event)
+{
+    Register_I2C_SignalEvent(0, event);
+}
+#endif
+
+#if defined(I2C1)
+/* The I2C1 Signal Event Handler function. */
+void I2C1_SignalEvent_t(uint32_t event)
+{
+    Register_I2C_SignalEvent(1, event);
+}
+#endif
+
+#if defined(I2C2)
+/* The I2C2 Signal Event Handler function. */
+void I2C2_SignalEvent_t(uint32_t event)
+{
+    Register_I2C_SignalEvent(2, event);
+}
+#endif
+
+#if defined(I2C3)
+/* The I2C3 Signal Event Handler function. */
+void I2C3_SignalEvent_t(uint32_t event)
+{
+    Register_I2C_SignalEvent(3, event);
+}
+#endif
+
+#if defined(I2C4)
+/* The I2C4 Signal Event Handler function. */
+void I2C4_SignalEvent_t(uint32_t event)
+{
+    Register_I2C_SignalEvent(4, event);
 }
+#endif
+
+#if defined(I2C5)
+/* The I2C5 Signal Event Handler function. */
+void I2C5_SignalEvent_t(uint32_t event)
+{
+    Register_I2C_SignalEvent(5, event);
+}
+#endif
+
+#if defined(I2C6)
+/* The I2C6 Signal Event Handler function. */
+void I2C6_SignalEvent_t(uint32_t event)
+{
+    Register_I2C_SignalEvent(6, event);
+}
+#endif
+
+#if defined(I2C7)
+/* The I2C7 Signal Event Handler function. */
+void I2C7_SignalEvent_t(uint32_t event)
+{
+    Register_I2C_SignalEvent(7, event);
+}
+#endif
+
+#ifdef MIMXRT500_AGM01
+#if defined(I2C11)
+/* The I2C11 Signal Event Handler function. */
+void I2C11_SignalEvent_t(uint32_t event)
+{
+    Register_I2C_SignalEvent(11, event);
+}
+#endif
+#endif
+
+/* Get the Signal Event Handler of an I2C instance, NULL for an instance without one. */
+static ARM_I2C_SignalEvent_t Register_I2C_SignalEventOf(uint8_t deviceInstance)
+{
+    switch (deviceInstance)
+    {
+#if defined(I2C0)
+        case 0:
+            return I2C0_SignalEvent_t;
+#endif
+#if defined(I2C1)
+        case 1:
+            return I2C1_SignalEvent_t;
+#endif
+#if defined(I2C2)
+        case 2:
+            return I2C2_SignalEvent_t;
+#endif
+#if defined(I2C3)
+        case 3:
+            return I2C3_SignalEvent_t;
+#endif
+#if defined(I2C4)
+        case 4:
+            return I2C4_SignalEvent_t;
+#endif
+#if defined(I2C5)
+        case 5:
+            return I2C5_SignalEvent_t;
+#endif
+#if defined(I2C6)
+        case 6:
+            return I2C6_SignalEvent_t;
+#endif
+#if defined(I2C7)
+        case 7:
+            return I2C7_SignalEvent_t;
+#endif
+#ifdef MIMXRT500_AGM01
+#if defined(I2C11)
+        case 11:
+            return I2C11_SignalEvent_t;
+#endif
+#endif
+        default:
+            return NULL;
+    }
+}
+
+/*! Binds an I/O context to an I2C instance and initializes its driver. */
+int32_t Register_I2C_Initialize(ARM_DRIVER_I2C *pCommDrv, uint8_t deviceInstance, registerIoContext_t *pContext)
+{
+    ARM_I2C_SignalEvent_t signalEvent;
+    uint32_t primask;
+
+    if ((pCommDrv == NULL) || (deviceInstance >= I2C_COUNT))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    signalEvent = Register_I2C_SignalEventOf(deviceInstance);
+    if (signalEvent == NULL)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    if ((Register_I2C_Context(deviceInstance)->pAsyncTransfer != NULL) ||
+        Register_I2C_Context(deviceInstance)->blocking)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    if (pContext == NULL)
+    {
+        pContext = &s_defaultContext[deviceInstance];
+    }
+    memset(pContext, 0, sizeof(registerIoContext_t));
+    pContext->errorEvent = ARM_I2C_EVENT_TRANSFER_DONE;
+
+    /*! Swapped with interrupts masked, the Signal Event Handler sees either context whole. */
+    primask = DisableGlobalIRQ();
+    g_I2C_Context[deviceInstance] = pContext;
+    EnableGlobalIRQ(primask);
+
+    return pCommDrv->Initialize(signalEvent);
+}
+
+/* Take the bus for a blocking call, once the asynchronous transfer in flight is over. */
+static int32_t Register_I2C_Acquire(ARM_DRIVER_I2C *pCommDrv, registerDeviceInfo_t *devInfo)
+{
+    registerIoContext_t *pContext = Register_I2C_Context(devInfo->deviceInstance);
+    registerAsyncTransfer_t *pXfer;
+    uint32_t timeout = Register_I2C_Timeout(devInfo);
+    uint32_t primask = DisableGlobalIRQ();
+
+    if (pContext->blocking)
+    {
+        EnableGlobalIRQ(primask);
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+    /*! Set first, so that no asynchronous transfer starts behind the one waited for. */
+    pContext->blocking = true;
+    EnableGlobalIRQ(primask);
+
+    while ((pXfer = pContext->pAsyncTransfer) != NULL)
+    {
+        if (Register_I2C_Expired(pXfer->startTick, timeout) && (pContext->pAsyncTransfer == pXfer))
+        {
+            /*! The recovery completes the transfer with ARM_DRIVER_ERROR_TIMEOUT. */
+            Register_I2C_TimedOut(pCommDrv, devInfo);
+            continue;
+        }
+        Register_I2C_Idle(devInfo, pXfer, pXfer->startTick, timeout);
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+/* Release the bus at the end of a blocking call. */
+static void Register_I2C_Release(registerDeviceInfo_t *devInfo)
+{
+    registerIoContext_t *pContext = Register_I2C_Context(devInfo->deviceInstance);
+
+    pContext->blocking = false;
+    if (pContext->busFree != NULL)
+    {
+        pContext->busFree(pContext->pBusFreeParam);
+    }
+}
+
+/* Wait before a retry. No interrupt marks its end, so a sleeping wait mode spins instead. A pass takes at
+ * least one core cycle, so ticks passes end the wait when the SysTick is not running. */
+static void Register_I2C_Backoff(registerDeviceInfo_t *devInfo, uint32_t us)
+{
+    uint32_t start = BOARD_SystickGetTicks();
+    uint32_t ticks = Register_I2C_Ticks(us);
+    uint32_t passes;
+
+    for (passes = 0; (passes < ticks) && !Register_I2C_Expired(start, ticks); passes++)
+    {
+        if (devInfo->waitMode == REGISTER_WAIT_YIELD)
+        {
+            Register_I2C_Yield(devInfo);
+        }
+        else
+        {
+            __NOP();
+        }
+    }
+}
+
+/* Decide whether to start a failed operation again, and wait for the backoff of its error class if so. */
+static bool Register_I2C_Retry(registerDeviceInfo_t *devInfo, int32_t status, uint8_t *pRetries)
+{
+    const registerIoContext_t *pContext;
+    const registerRetryPolicy_t *pPolicy;
+    uint32_t errorClass, backoffUs, i;
+
+    switch (status)
+    {
+        case REGISTER_ERROR_ADDRESS_NACK:
+            errorClass = REGISTER_ERROR_CLASS_ADDRESS_NACK;
+            break;
+        case REGISTER_ERROR_DATA_NACK:
+            errorClass = REGISTER_ERROR_CLASS_DATA_NACK;
+            break;
+        case REGISTER_ERROR_ARBITRATION_LOST:
+            errorClass = REGISTER_ERROR_CLASS_ARBITRATION_LOST;
+            break;
+        case REGISTER_ERROR_BUS_ERROR:
+            errorClass = REGISTER_ERROR_CLASS_BUS_ERROR;
+            break;
+        case REGISTER_ERROR_INCOMPLETE:
+            errorClass = REGISTER_ERROR_CLASS_INCOMPLETE;
+            break;
+        case ARM_DRIVER_ERROR_TIMEOUT:
+            errorClass = REGISTER_ERROR_CLASS_TIMEOUT;
+            break;
+        default:
+            /*! Success, a busy bus or a bad parameter do not change on a retry. */
+            return false;
+    }
+
+    pContext = Register_I2C_Context(devInfo->deviceInstance);
+    pPolicy = pContext->retryPolicySet ? &pContext->retryPolicy[errorClass] : &s_defaultRetryPolicy[errorClass];
+    if (pRetries[errorClass] >= pPolicy->maxRetries)
+    {
+        return false;
+    }
+
+    backoffUs = pPolicy->backoffUs;
+    for (i = 0; (i < pRetries[errorClass]) && (backoffUs < pPolicy->maxBackoffUs); i++)
+    {
+        backoffUs <<= 1;
+    }
+    if (backoffUs > pPolicy->maxBackoffUs)
+    {
+        backoffUs = pPolicy->maxBackoffUs;
+    }
+    pRetries[errorClass]++;
+#if REGISTER_IO_STATS
+    devInfo->stats.retries++;
+#endif
+    Register_I2C_Backoff(devInfo, backoffUs);
+
+    return true;
+}
+
+static int32_t Register_I2C_TransferClaim(ARM_DRIVER_I2C *pCommDrv,
+                                          registerDeviceInfo_t *devInfo,
+                                          uint16_t slaveAddress,
+                                          const registerTransfer_t *pTransfer,
+                                          registerAsyncTransfer_t *pXfer,
+                                          registerasynccallback_t callback,
+                                          void *pUserData,
+                                          bool blocking);
+
+/* Run one attempt of a combined register transfer. */
+static int32_t Register_I2C_TransferOnce(ARM_DRIVER_I2C *pCommDrv,
+                                         registerDeviceInfo_t *devInfo,
+                                         uint16_t slaveAddress,
+                                         const registerTransfer_t *pTransfer)
+{
+    registerAsyncTransfer_t xfer;
+    int32_t status;
+    uint32_t start = BOARD_SystickGetTicks();
+    uint32_t timeout = Register_I2C_Timeout(devInfo);
+#if REGISTER_IO_STATS
+    uint32_t iterations = 0;
+#endif
+
+    /*! The Signal Event Handler runs the phases, this thread waits for the last one only. */
+    xfer.state = REGISTER_ASYNC_IDLE;
+    status = Register_I2C_TransferClaim(pCommDrv, devInfo, slaveAddress, pTransfer, &xfer, NULL, NULL, true);
+    if (ARM_DRIVER_OK != status)
+    {
+        return status;
+    }
+
+    while (xfer.state != REGISTER_ASYNC_IDLE)
+    {
+        /*! The recovery completes the transfer with ARM_DRIVER_ERROR_TIMEOUT. */
+        if (Register_I2C_Expired(start, timeout) && (xfer.state != REGISTER_ASYNC_IDLE))
+        {
+            Register_I2C_TimedOut(pCommDrv, devInfo);
+            break;
+        }
+        Register_I2C_Idle(devInfo, &xfer, start, timeout);
+#if REGISTER_IO_STATS
+        iterations++;
+#endif
+    }
+#if REGISTER_IO_STATS
+    Register_I2C_CountWait(devInfo, iterations);
+#endif
+
+    return xfer.status;
+}
+
+/* Run one attempt of a block write. */
+static int32_t Register_I2C_BlockWriteOnce(ARM_DRIVER_I2C *pCommDrv,
+                                           registerDeviceInfo_t *devInfo,
+                                           uint16_t slaveAddress,
+                                           uint8_t offset,
+                                           const uint8_t *pBuffer,
+                                           uint8_t bytesToWrite)
+{
+    registerIoContext_t *pContext = Register_I2C_Context(devInfo->deviceInstance);
+    int32_t status;
+    uint8_t buffer[SENSOR_MAX_REGISTER_COUNT];
+
+    buffer[0] = offset;
+    memcpy(buffer + 1, pBuffer, bytesToWrite);
+    pCommDrv = Register_I2C_Transport(pCommDrv, devInfo, bytesToWrite);
+
+    pContext->completionFlag = false;
+    pContext->errorEvent = ARM_I2C_EVENT_TRANSFER_DONE;
+    status = pCommDrv->MasterTransmit(slaveAddress, buffer, bytesToWrite + 1, false);
+    if (ARM_DRIVER_OK == status)
+    {
+        REGISTER_IO_COUNT_TRANSFER(devInfo, bytesToWrite + 1, 0);
+        status = Register_I2C_Wait(pCommDrv, devInfo);
+    }
+
+    return status;
+}
+
+/*! The interface function to block write sensor registers. */
+int32_t Register_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
+                                registerDeviceInfo_t *devInfo,
+                                uint16_t slaveAddress,
+                                uint8_t offset,
+                                const uint8_t *pBuffer,
+                                uint8_t bytesToWrite)
+{
+    uint8_t retries[REGISTER_ERROR_CLASS_COUNT] = {0};
+    int32_t status = Register_I2C_Acquire(pCommDrv, devInfo);
+
+    if (ARM_DRIVER_OK != status)
+    {
+        return status;
+    }
+    do
+    {
+        status = Register_I2C_BlockWriteOnce(pCommDrv, devInfo, slaveAddress, offset, pBuffer, bytesToWrite);
+    } while (Register_I2C_Retry(devInfo, status, retries));
+    Register_I2C_Release(devInfo);
+
+    return status;
+}
+
+/* Run one attempt of a register write, a read-modify-write when mask is not 0. */
+static int32_t Register_I2C_WriteOnce(ARM_DRIVER_I2C *pCommDrv,
+                                      registerDeviceInfo_t *devInfo,
+                                      uint16_t slaveAddress,
+                                      uint8_t offset,
+                                      uint8_t value,
+                                      uint8_t mask,
+                                      bool repeatedStart)
+{
+    registerIoContext_t *pContext = Register_I2C_Context(devInfo->deviceInstance);
+    int32_t status;
+    uint8_t config[] = {offset, 0x00};
+
+    pCommDrv = Register_I2C_Transport(pCommDrv, devInfo, 1);
+
+    /*! Set the register based on the values in the register value pair configuration.*/
+    if (mask)
+    {
+        /*! Send the register address and read the value in one combined transfer.*/
+        registerTransfer_t read = {&config[0], 1, &config[1], 1};
+
+        status = Register_I2C_TransferOnce(pCommDrv, devInfo, slaveAddress, &read);
+        if (ARM_DRIVER_OK != status)
+        {
+            return status;
+        }
+        /*! 'OR' in the requested values to the current contents of the register */
+        config[1] = (config[1] & ~mask) | value;
+    }
+    else
+    {
+        /*! Overwrite the register with specified value.*/
+        config[1] = value;
+    }
+
+    pContext->completionFlag = false;
+    pContext->errorEvent = ARM_I2C_EVENT_TRANSFER_DONE;
+    /*!  Write the updated value. */
+    status = pCommDrv->MasterTransmit(slaveAddress, config, sizeof(config), repeatedStart);
+    if (ARM_DRIVER_OK == status)
+    {
+        REGISTER_IO_COUNT_TRANSFER(devInfo, sizeof(config), 0);
+        status = Register_I2C_Wait(pCommDrv, devInfo);
+    }
+
+    return status;
+}
+
+/*! The interface function to write a sensor register. */
+int32_t Register_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
+                           registerDeviceInfo_t *devInfo,
+                           uint16_t slaveAddress,
+                           uint8_t offset,
+                           uint8_t value,
+                           uint8_t mask,
+                           bool repeatedStart)
+{
+    uint8_t retries[REGISTER_ERROR_CLASS_COUNT] = {0};
+    int32_t status = Register_I2C_Acquire(pCommDrv, devInfo);
+
+    if (ARM_DRIVER_OK != status)
+    {
+        return status;
+    }
+    /*! A retry reads the register again, another writer may have changed it meanwhile. */
+    do
+    {
+        status = Register_I2C_WriteOnce(pCommDrv, devInfo, slaveAddress, offset, value, mask, repeatedStart);
+    } while (Register_I2C_Retry(devInfo, status, retries));
+    Register_I2C_Release(devInfo);
+
+    return status;
+}
+
+/*! The interface function to read a sensor register. */
+int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
+                          registerDeviceInfo_t *devInfo,
+                          uint16_t slaveAddress,
+                          uint8_t offset,
+                          uint8_t length,
+                          uint8_t *pOutBuffer)
+{
+    registerTransfer_t read = {&offset, 1, pOutBuffer, length};
+
+    return Register_I2C_Transfer(pCommDrv, devInfo, slaveAddress, &read);
+}
+
+/*! Claim the bus for an asynchronous transfer, blocking is true for the transfers of the blocking call owning
+ *  the bus. */
+static int32_t Register_I2C_AsyncClaim(registerDeviceInfo_t *devInfo, registerAsyncTransfer_t *pXfer, bool blocking)
+{
+    registerIoContext_t *pContext = Register_I2C_Context(devInfo->deviceInstance);
+    int32_t status = ARM_DRIVER_ERROR_BUSY;
+    uint32_t primask = DisableGlobalIRQ();
+
+    if ((pContext->pAsyncTransfer == NULL) && (blocking || !pContext->blocking) &&
+        (pXfer->state == REGISTER_ASYNC_IDLE))
+    {
+        pContext->pAsyncTransfer = pXfer;
+        status = ARM_DRIVER_OK;
+    }
+    EnableGlobalIRQ(primask);
+
+    return status;
+}
+
+/*! Start the write phase of a claimed asynchronous transfer, pXfer->buffer holds its bytes. */
+static int32_t Register_I2C_AsyncStart(ARM_DRIVER_I2C *pCommDrv,
+                                       registerDeviceInfo_t *devInfo,
+                                       uint16_t slaveAddress,
+                                       uint8_t writeLength,
+                                       uint8_t *pReadBuffer,
+                                       uint8_t readLength,
+                                       registerAsyncTransfer_t *pXfer,
+                                       registerasynccallback_t callback,
+                                       void *pUserData)
+{
+    int32_t status;
+
+    /*! Both phases go through the same driver, which holds the bus in between. */
+    pCommDrv = Register_I2C_Transport(pCommDrv, devInfo, readLength ? readLength : (uint32_t)(writeLength - 1));
+    pXfer->pCommDrv = pCommDrv;
+    pXfer->slaveAddress = slaveAddress;
+    pXfer->pBuffer = pReadBuffer;
+    pXfer->length = readLength;
+    pXfer->callback = callback;
+    pXfer->pUserData = pUserData;
+    pXfer->status = ARM_DRIVER_OK;
+    pXfer->startTick = BOARD_SystickGetTicks();
+#if REGISTER_IO_STATS
+    pXfer->devInfo = devInfo;
+#endif
+    pXfer->state = readLength ? REGISTER_ASYNC_ADDRESS : REGISTER_ASYNC_DATA;
+
+    /*! Counted first, a driver which completes before returning chains the read phase from this call. */
+    REGISTER_IO_COUNT_TRANSFER(devInfo, writeLength, 0);
+    status = pCommDrv->MasterTransmit(slaveAddress, pXfer->buffer, writeLength, readLength != 0);
+    if (ARM_DRIVER_OK != status)
+    {
+        pXfer->state = REGISTER_ASYNC_IDLE;
+        Register_I2C_Context(devInfo->deviceInstance)->pAsyncTransfer = NULL;
+    }
+
+    return status;
+}
+
+
+/*! The interface function to run a combined register transfer. */
+int32_t Register_I2C_Transfer(ARM_DRIVER_I2C *pCommDrv,
+                              registerDeviceInfo_t *devInfo,
+                              uint16_t slaveAddress,
+                              const registerTransfer_t *pTransfer)
+{
+    uint8_t retries[REGISTER_ERROR_CLASS_COUNT] = {0};
+    int32_t status = Register_I2C_Acquire(pCommDrv, devInfo);
+
+    if (ARM_DRIVER_OK != status)
+    {
+        return status;
+    }
+    do
+    {
+        status = Register_I2C_TransferOnce(pCommDrv, devInfo, slaveAddress, pTransfer);
+    } while (Register_I2C_Retry(devInfo, status, retries));
+    Register_I2C_Release(devInfo);
+
+    return status;
+}
+
+/*! Claim the bus for a combined register transfer and start it. */
+static int32_t Register_I2C_TransferClaim(ARM_DRIVER_I2C *pCommDrv,
+                                          registerDeviceInfo_t *devInfo,
+                                          uint16_t slaveAddress,
+                                          const registerTransfer_t *pTransfer,
+                                          registerAsyncTransfer_t *pXfer,
+                                          registerasynccallback_t callback,
+                                          void *pUserData,
+                                          bool blocking)
+{
+    int32_t status;
+
+    if ((pTransfer->writeLength == 0) || (pTransfer->writeLength > REGISTER_ASYNC_BUFFER_SIZE) ||
+        ((pTransfer->readLength != 0) && (pTransfer->pReadBuffer == NULL)))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    status = Register_I2C_AsyncClaim(devInfo, pXfer, blocking);
+    if (ARM_DRIVER_OK != status)
+    {
+        return status;
+    }
+
+    memcpy(pXfer->buffer, pTransfer->pWriteBuffer, pTransfer->writeLength);
+
+    return Register_I2C_AsyncStart(pCommDrv, devInfo, slaveAddress, pTransfer->writeLength, pTransfer->pReadBuffer,
+                                   pTransfer->readLength, pXfer, callback, pUserData);
+}
+
+/*! The interface function to run a combined register transfer without blocking. */
+int32_t Register_I2C_TransferAsync(ARM_DRIVER_I2C *pCommDrv,
+                                   registerDeviceInfo_t *devInfo,
+                                   uint16_t slaveAddress,
+                                   const registerTransfer_t *pTransfer,
+                                   registerAsyncTransfer_t *pXfer,
+                                   registerasynccallback_t callback,
+                                   void *pUserData)
+{
+    return Register_I2C_TransferClaim(pCommDrv, devInfo, slaveAddress, pTransfer, pXfer, callback, pUserData, false);
+}
+
+/*! The interface function to read sensor registers without blocking. */
+int32_t Register_I2C_ReadAsync(ARM_DRIVER_I2C *pCommDrv,
+                               registerDeviceInfo_t *devInfo,
+                               uint16_t slaveAddress,
+                               uint8_t offset,
+                               uint8_t length,
+                               uint8_t *pOutBuffer,
+                               registerAsyncTransfer_t *pXfer,
+                               registerasynccallback_t callback,
+                               void *pUserData)
+{
+    registerTransfer_t read = {&offset, 1, pOutBuffer, length};
+
+    return Register_I2C_TransferAsync(pCommDrv, devInfo, slaveAddress, &read, pXfer, callback, pUserData);
+}
+
+/*! The interface function to block write sensor registers without blocking. */
+int32_t Register_I2C_BlockWriteAsync(ARM_DRIVER_I2C *pCommDrv,
+                                     registerDeviceInfo_t *devInfo,
+                                     uint16_t slaveAddress,
+                                     uint8_t offset,
+                                     const uint8_t *pBuffer,
+                                     uint8_t bytesToWrite,
+                                     registerAsyncTransfer_t *pXfer,
+                                     registerasynccallback_t callback,
+                                     void *pUserData)
+{
+    int32_t status;
+
+    if (bytesToWrite >= REGISTER_ASYNC_BUFFER_SIZE)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    status = Register_I2C_AsyncClaim(devInfo, pXfer, false);
+    if (ARM_DRIVER_OK != status)
+    {
+        return status;
+    }
+
+    pXfer->buffer[0] = offset;
+    memcpy(pXfer->buffer + 1, pBuffer, bytesToWrite);
+
+    return Register_I2C_AsyncStart(pCommDrv, devInfo, slaveAddress, bytesToWrite + 1, NULL, 0, pXfer, callback,
+                                   pUserData);
+}
+
+/*! Sets the transports of an I2C instance. */
+int32_t Register_I2C_SetTransport(uint8_t deviceInstance, const registerTransport_t *pTransport)
+{
+    registerIoContext_t *pContext;
+
+    if (deviceInstance >= I2C_COUNT)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    pContext = Register_I2C_Context(deviceInstance);
+    if (pContext->pAsyncTransfer != NULL)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    if (pTransport == NULL)
+    {
+        memset(&pContext->transport, 0, sizeof(registerTransport_t));
+    }
+    else
+    {
+        pContext->transport = *pTransport;
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+/*! Sets the retry policies of an I2C instance. */
+int32_t Register_I2C_SetRetryPolicy(uint8_t deviceInstance, const registerRetryPolicy_t *pPolicies)
+{
+    registerIoContext_t *pContext;
+
+    if (deviceInstance >= I2C_COUNT)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    pContext = Register_I2C_Context(deviceInstance);
+    if (pContext->pAsyncTransfer != NULL)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    if (pPolicies != NULL)
+    {
+        memcpy(pContext->retryPolicy, pPolicies, sizeof(pContext->retryPolicy));
+    }
+    pContext->retryPolicySet = (pPolicies != NULL);
+
+    return ARM_DRIVER_OK;
+}
+
+/*! Sets the bus recovery of an I2C instance. */
+int32_t Register_I2C_SetRecovery(uint8_t deviceInstance, const registerBusRecovery_t *pRecovery)
+{
+    registerIoContext_t *pContext;
+
+    if (deviceInstance >= I2C_COUNT)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    pContext = Register_I2C_Context(deviceInstance);
+    if (pContext->pAsyncTransfer != NULL)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    if (pRecovery == NULL)
+    {
+        memset(&pContext->recovery, 0, sizeof(registerBusRecovery_t));
+    }
+    else
+    {
+        pContext->recovery = *pRecovery;
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+/* Busy wait on the SysTick, the bus recovery runs without interrupts from the I2C driver. A pass takes at least
+ * one core cycle, so ticks passes end the wait when the SysTick is not running. */
+static void Register_I2C_Delay(uint32_t ticks)
+{
+    uint32_t start = BOARD_SystickGetTicks();
+    uint32_t passes;
+
+    for (passes = 0; (passes < ticks) && !Register_I2C_Expired(start, ticks); passes++)
+    {
+        __NOP();
+    }
+}
+
+/* Clock SCL on the GPIO until the device releases SDA, then send a STOP. */
+static int32_t Register_I2C_ClockOut(const registerBusRecovery_t *pRecovery)
+{
+    GENERIC_DRIVER_GPIO *pGpioDrv = pRecovery->pGpioDrv;
+    uint32_t halfPeriod =
+        Register_I2C_Ticks(pRecovery->halfPeriodUs ? pRecovery->halfPeriodUs : REGISTER_RECOVERY_HALF_PERIOD_US);
+    uint32_t pulses;
+    int32_t status = ARM_DRIVER_OK;
+
+    if (pRecovery->setPinMux)
+    {
+        pRecovery->setPinMux(pRecovery->pMuxParam, true);
+    }
+    pGpioDrv->set_pin(pRecovery->sclPin);
+    pGpioDrv->set_pin(pRecovery->sdaPin);
+    Register_I2C_Delay(halfPeriod);
+
+    /*! Each pulse shifts out one bit of the device, which releases SDA once its byte and ACK are done. */
+    for (pulses = 0; (pulses < REGISTER_RECOVERY_CLOCKS) && !pGpioDrv->read_pin(pRecovery->sdaPin); pulses++)
+    {
+        pGpioDrv->clr_pin(pRecovery->sclPin);
+        Register_I2C_Delay(halfPeriod);
+        pGpioDrv->set_pin(pRecovery->sclPin);
+        Register_I2C_Delay(halfPeriod);
+    }
+    if (!pGpioDrv->read_pin(pRecovery->sdaPin))
+    {
+        status = ARM_DRIVER_ERROR;
+    }
+
+    /*! STOP: SDA rises while SCL is high. */
+    pGpioDrv->clr_pin(pRecovery->sclPin);
+    Register_I2C_Delay(halfPeriod);
+    pGpioDrv->clr_pin(pRecovery->sdaPin);
+    Register_I2C_Delay(halfPeriod);
+    pGpioDrv->set_pin(pRecovery->sclPin);
+    Register_I2C_Delay(halfPeriod);
+    pGpioDrv->set_pin(pRecovery->sdaPin);
+    Register_I2C_Delay(halfPeriod);
+
+    if (pRecovery->setPinMux)
+    {
+        pRecovery->setPinMux(pRecovery->pMuxParam, false);
+    }
+
+    return status;
+}
+
+/*! Recovers the bus of a device. */
+int32_t Register_I2C_Recover(ARM_DRIVER_I2C *pCommDrv, registerDeviceInfo_t *devInfo)
+{
+    registerIoContext_t *pContext;
+    const registerBusRecovery_t *pRecovery;
+    registerAsyncTransfer_t *pXfer;
+    registerasynccallback_t callback = NULL;
+    void *pUserData = NULL;
+    uint32_t primask;
+    int32_t status = ARM_DRIVER_OK;
+
+    if ((pCommDrv == NULL) || (devInfo == NULL) || (devInfo->deviceInstance >= I2C_COUNT))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    pContext = Register_I2C_Context(devInfo->deviceInstance);
+    pRecovery = &pContext->recovery;
+
+    /*! Abort before the transfer is dropped, so that no event of it follows. */
+    primask = DisableGlobalIRQ();
+    pXfer = pContext->pAsyncTransfer;
+    if (pXfer != NULL)
+    {
+        pXfer->pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
+        callback = pXfer->callback;
+        pUserData = pXfer->pUserData;
+        pContext->pAsyncTransfer = NULL;
+        pXfer->status = ARM_DRIVER_ERROR_TIMEOUT;
+        pXfer->state = REGISTER_ASYNC_IDLE;
+    }
+    EnableGlobalIRQ(primask);
+    pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
+#if REGISTER_IO_STATS
+    devInfo->stats.aborts++;
+    devInfo->stats.recoveries++;
+#endif
+
+    if (pRecovery->pGpioDrv != NULL)
+    {
+        status = Register_I2C_ClockOut(pRecovery);
+    }
+    else
+    {
+        /*! Not every driver supports it, the re-initialization follows anyway. */
+        (void)pCommDrv->Control(ARM_I2C_BUS_CLEAR, 0);
+    }
+
+    if (pRecovery->busSpeed != 0)
+    {
+        (void)pCommDrv->PowerControl(ARM_POWER_OFF);
+        if ((ARM_DRIVER_OK != pCommDrv->PowerControl(ARM_POWER_FULL)) ||
+            (ARM_DRIVER_OK != pCommDrv->Control(ARM_I2C_BUS_SPEED, pRecovery->busSpeed)))
+        {
+            status = ARM_DRIVER_ERROR;
+        }
+    }
+
+    /*! Last, so that the callback can start the next transfer on the recovered bus. */
+    if (callback)
+    {
+        callback(pUserData, ARM_DRIVER_ERROR_TIMEOUT);
+    }
+    if ((pXfer != NULL) && (pContext->busFree != NULL) && (pContext->pAsyncTransfer == NULL))
+    {
+        pContext->busFree(pContext->pBusFreeParam);
+    }
+
+    return status;
+}
+
+/*! Recovers the bus of a device when the asynchronous transfer in flight on it is late. */
+int32_t Register_I2C_CheckDeadline(ARM_DRIVER_I2C *pCommDrv, registerDeviceInfo_t *devInfo)
+{
+    registerAsyncTransfer_t *pXfer;
+
+    if ((pCommDrv == NULL) || (devInfo == NULL) || (devInfo->deviceInstance >= I2C_COUNT))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    pXfer = Register_I2C_Context(devInfo->deviceInstance)->pAsyncTransfer;
+    if ((pXfer == NULL) || !Register_I2C_Expired(pXfer->startTick, Register_I2C_Timeout(devInfo)))
+    {
+        return ARM_DRIVER_OK;
+    }
+    /*! Checked again, the transfer may have completed meanwhile. */
+    if (Register_I2C_Context(devInfo->deviceInstance)->pAsyncTransfer != pXfer)
+    {
+        return ARM_DRIVER_OK;
+    }
+    Register_I2C_TimedOut(pCommDrv, devInfo);
+
+    return ARM_DRIVER_ERROR_TIMEOUT;
+}
+
+/*! Sets the function called each time a transfer releases the bus of an I2C instance. */
+int32_t Register_I2C_SetBusFree(uint8_t deviceInstance, registerbusfreefunction_t busFree, void *pParam)
+{
+    registerIoContext_t *pContext;
+    uint32_t primask;
+
+    if (deviceInstance >= I2C_COUNT)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    pContext = Register_I2C_Context(deviceInstance);
+    primask = DisableGlobalIRQ();
+    pContext->busFree = busFree;
+    pContext->pBusFreeParam = pParam;
+    EnableGlobalIRQ(primask);
+
+    return ARM_DRIVER_OK;
+}
+
+/*! Selects the driver of a register transfer. */
+ARM_DRIVER_I2C *Register_I2C_SelectTransport(ARM_DRIVER_I2C *pCommDrv, uint8_t deviceInstance, uint32_t dataBytes)
+{
+    const registerTransport_t *pTransport;
+
+    if (deviceInstance >= I2C_COUNT)
+    {
+        return pCommDrv;
+    }
+
+    /*! A DMA transfer costs a channel setup but only one interrupt, against one interrupt per byte. */
+    pTransport = &Register_I2C_Context(deviceInstance)->transport;
+    if ((pTransport->pDmaDrv != NULL) && (dataBytes >= pTransport->dmaMinBytes))
+    {
+        return pTransport->pDmaDrv;
+    }
+
+    return pCommDrv;
+}
+
+#if REGISTER_IO_STATS
+/*! Gets the register I/O counters of a device. */
+int32_t Register_I2C_GetStats(registerDeviceInfo_t *devInfo, registerIoStats_t *pStats)
+{
+    uint32_t primask;
+
+    if ((devInfo == NULL) || (pStats == NULL))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    /*! Asynchronous transfers count from the interrupt context. */
+    primask = DisableGlobalIRQ();
+    *pStats = devInfo->stats;
+    EnableGlobalIRQ(primask);
+
+    return ARM_DRIVER_OK;
+}
+
+/*! Clears the register I/O counters of a device. */
+void Register_I2C_ResetStats(registerDeviceInfo_t *devInfo)
+{
+    uint32_t primask;
+
+    if (devInfo == NULL)
+    {
+        return;
+    }
+
+    primask = DisableGlobalIRQ();
+    memset(&devInfo->stats, 0, sizeof(registerIoStats_t));
+    EnableGlobalIRQ(primask);
+}
+#endif
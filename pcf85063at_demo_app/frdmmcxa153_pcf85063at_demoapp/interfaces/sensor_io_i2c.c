@@ -12,6 +12,9 @@
  *  for reading and writing data from/to sensor.
  */
 
+/* Standard C Includes */
+#include <string.h>
+
 #include "Driver_I2C.h"
 #include "sensor_drv.h"
 #include "systick_utils.h"
@@ -74,7 +77,10 @@ int32_t Sensor_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
                          const registerwritelist_t *pRegWriteList)
 {
     int32_t status;
-    bool repeatedStart;
+    bool needRead;
+    uint8_t count, first, length, i, mask;
+    registerwritelist_t batch[SENSOR_I2C_WRITE_BATCH];
+    uint8_t regs[SENSOR_I2C_WRITE_BATCH];
 
     /*! Validate for the correct handle.*/
     if ((pCommDrv == NULL) || (pRegWriteList == NULL))
@@ -84,19 +90,62 @@ int32_t Sensor_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
 
     const registerwritelist_t *pCmd = pRegWriteList;
 
-    /*! Update register values based on register write list unless the next Cmd is the list terminator */
-    do
+    /*! Update register values based on register write list until the list terminator */
+    while (pCmd->writeTo != 0xFFFF)
     {
-        repeatedStart = (pCmd + 1)->writeTo != 0xFFFF;
-        /*! Set the register based on the values in the register value pair.*/
-        status =
-            Register_I2C_Write(pCommDrv, devInfo, slaveAddress, pCmd->writeTo, pCmd->value, pCmd->mask, repeatedStart);
-        if (ARM_DRIVER_OK != status)
+        /*! Gather a batch sorted by register, a mask of 0xFF stands for an overwrite.*/
+        for (count = 0; (pCmd->writeTo != 0xFFFF) && (count < SENSOR_I2C_WRITE_BATCH); pCmd++)
         {
-            return SENSOR_ERROR_WRITE;
+            mask = pCmd->mask ? pCmd->mask : 0xFF;
+            i = 0;
+            while ((i < count) && (batch[i].writeTo < pCmd->writeTo))
+            {
+                i++;
+            }
+            if ((i < count) && (batch[i].writeTo == pCmd->writeTo))
+            {
+                /*! Same register, fold the entry into the previous ones as if applied in list order.*/
+                batch[i].value = (batch[i].value & ~mask) | pCmd->value;
+                batch[i].mask |= mask;
+                continue;
+            }
+            memmove(&batch[i + 1], &batch[i], (count - i) * sizeof(registerwritelist_t));
+            batch[i].writeTo = pCmd->writeTo;
+            batch[i].value = pCmd->value;
+            batch[i].mask = mask;
+            count++;
+        }
+
+        /*! One block write per run of adjacent registers, read back first only if a field is masked.*/
+        for (first = 0; first < count; first += length)
+        {
+            needRead = false;
+            for (length = 0; ((first + length) < count) && (batch[first + length].writeTo == batch[first].writeTo + length);
+                 length++)
+            {
+                needRead |= (batch[first + length].mask != 0xFF);
+            }
+
+            if (needRead)
+            {
+                status = Register_I2C_Read(pCommDrv, devInfo, slaveAddress, batch[first].writeTo, length, regs);
+                if (ARM_DRIVER_OK != status)
+                {
+                    return SENSOR_ERROR_WRITE;
+                }
+            }
+            for (i = 0; i < length; i++)
+            {
+                regs[i] = (needRead ? (regs[i] & ~batch[first + i].mask) : 0) | batch[first + i].value;
+            }
+
+            status = Register_I2C_BlockWrite(pCommDrv, devInfo, slaveAddress, batch[first].writeTo, regs, length);
+            if (ARM_DRIVER_OK != status)
+            {
+                return SENSOR_ERROR_WRITE;
+            }
         }
-        ++pCmd;
-    } while (repeatedStart);
+    }
 
     return SENSOR_ERROR_NONE;
 }
@@ -147,6 +147,9 @@ typedef union
 #define PCF85063AT_CTRL2_COF_MASK       ((uint8_t)0x07)
 #define PCF85063AT_CTRL2_COF_SHIFT      ((uint8_t)0)
 
+/* Status flags set by the device. Writing 0 clears a flag, writing 1 leaves it unchanged. */
+#define PCF85063AT_CTRL2_FLAGS_MASK     (PCF85063AT_CTRL2_AF_MASK | PCF85063AT_CTRL2_TF_MASK)
+
 
 
 
@@ -0,0 +1,372 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * pcf85063at_alarms.c
+ *
+ * @file pcf85063at_alarms.c
+ * @brief The pcf85063at_alarms.c file implements the software alarm scheduler of the PCF85063AT RTC.
+ */
+
+#include <string.h>
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+
+#include "pcf85063at_alarms.h"
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+
+/*! Deadline of the alarm at a heap position. */
+#define PCF85063AT_ALARMS_EPOCH(pScheduler, index) ((pScheduler)->slot[(pScheduler)->heap[index]].epoch)
+
+/*! Put an alarm id at a heap position and record the position in its slot. */
+static void PCF85063AT_Alarms_Place(PCF85063AT_alarmscheduler_t *pScheduler, uint8_t index, uint8_t id)
+{
+	pScheduler->heap[index] = id;
+	pScheduler->slot[id].heapIndex = index;
+}
+
+/*! Move the alarm at index towards the root while it is nearer than its parent. */
+static void PCF85063AT_Alarms_SiftUp(PCF85063AT_alarmscheduler_t *pScheduler, uint8_t index)
+{
+	uint8_t id = pScheduler->heap[index];
+	uint32_t epoch = pScheduler->slot[id].epoch;
+	uint8_t parent;
+
+	while (index > 0)
+	{
+		parent = (index - 1) / 2;
+		if (PCF85063AT_ALARMS_EPOCH(pScheduler, parent) <= epoch)
+		{
+			break;
+		}
+		PCF85063AT_Alarms_Place(pScheduler, index, pScheduler->heap[parent]);
+		index = parent;
+	}
+	PCF85063AT_Alarms_Place(pScheduler, index, id);
+}
+
+/*! Move the alarm at index towards the leaves while a child is nearer. */
+static void PCF85063AT_Alarms_SiftDown(PCF85063AT_alarmscheduler_t *pScheduler, uint8_t index)
+{
+	uint8_t id = pScheduler->heap[index];
+	uint32_t epoch = pScheduler->slot[id].epoch;
+	uint32_t child;
+
+	for (;;)
+	{
+		child = 2U * index + 1U;
+		if (child >= pScheduler->count)
+		{
+			break;
+		}
+		if ((child + 1U < pScheduler->count) &&
+				(PCF85063AT_ALARMS_EPOCH(pScheduler, child + 1U) < PCF85063AT_ALARMS_EPOCH(pScheduler, child)))
+		{
+			child++;
+		}
+		if (epoch <= PCF85063AT_ALARMS_EPOCH(pScheduler, child))
+		{
+			break;
+		}
+		PCF85063AT_Alarms_Place(pScheduler, index, pScheduler->heap[child]);
+		index = (uint8_t)child;
+	}
+	PCF85063AT_Alarms_Place(pScheduler, index, id);
+}
+
+/*! Take the alarm at a heap position out of the heap, its id joins the free ones past the end of the heap. */
+static void PCF85063AT_Alarms_Remove(PCF85063AT_alarmscheduler_t *pScheduler, uint8_t index)
+{
+	uint8_t id = pScheduler->heap[index];
+	uint8_t last;
+
+	pScheduler->count--;
+	if (index == pScheduler->count)
+	{
+		return;
+	}
+
+	/*! Fill the hole with the last alarm, which may belong above or below it. */
+	last = pScheduler->heap[pScheduler->count];
+	PCF85063AT_Alarms_Place(pScheduler, pScheduler->count, id);
+	PCF85063AT_Alarms_Place(pScheduler, index, last);
+	PCF85063AT_Alarms_SiftUp(pScheduler, index);
+	if (pScheduler->slot[last].heapIndex == index)
+	{
+		PCF85063AT_Alarms_SiftDown(pScheduler, index);
+	}
+}
+
+/*! Call the callbacks of the alarms due at now, nearest first. Returns the number fired. */
+static uint32_t PCF85063AT_Alarms_Fire(PCF85063AT_alarmscheduler_t *pScheduler, uint32_t now)
+{
+	uint32_t fired = 0;
+	uint8_t id;
+
+	/*! Callbacks may insert or cancel alarms, the hardware alarm is programmed once they are done. */
+	pScheduler->inProcess = true;
+	while ((pScheduler->count > 0) && (PCF85063AT_ALARMS_EPOCH(pScheduler, 0) <= now))
+	{
+		id = pScheduler->heap[0];
+		PCF85063AT_Alarms_Remove(pScheduler, 0);
+		fired++;
+		pScheduler->slot[id].callback(id, pScheduler->slot[id].epoch, pScheduler->slot[id].pUserData);
+	}
+	pScheduler->inProcess = false;
+
+	return fired;
+}
+
+/*! Program the nearest alarm into the RTC, or disable the alarm interrupt when none is left.
+ *  pMissed tells whether the deadline programmed was reached already: the hardware alarm would only match
+ *  it again next month, so the caller fires it. */
+static int32_t PCF85063AT_Alarms_Arm(PCF85063AT_alarmscheduler_t *pScheduler, bool *pMissed)
+{
+	int32_t status;
+	uint32_t epoch, now;
+	bool wasArmed;
+	Mode12h_24h mode12_24;
+	PCF85063AT_timedata_t time;
+	PCF85063AT_alarmdata_t alarmtime;
+	PCF85063AT_alarmframe_t frame;
+
+	*pMissed = false;
+	if (pScheduler->inProcess)
+	{
+		return SENSOR_ERROR_NONE;
+	}
+
+	if (pScheduler->count == 0)
+	{
+		if (pScheduler->armed != true)
+		{
+			return SENSOR_ERROR_NONE;
+		}
+		pScheduler->armed = false;
+		return PCF85063AT_AlarmInt_Disable(pScheduler->pSensorHandle);
+	}
+
+	epoch = PCF85063AT_ALARMS_EPOCH(pScheduler, 0);
+	if (pScheduler->armed && (pScheduler->armedEpoch == epoch))
+	{
+		return SENSOR_ERROR_NONE;
+	}
+
+	/*! The alarm registers follow the 12h/24h mode of the time registers. */
+	status = PCF85063AT_12h_24h_Mode_Get(pScheduler->pSensorHandle, &mode12_24);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+	status = PCF85063AT_EpochToTime(epoch, mode12_24, &time);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	alarmtime.second = time.second;
+	alarmtime.minutes = time.minutes;
+	alarmtime.hours = time.hours;
+	alarmtime.days = time.days;
+	alarmtime.weekdays = time.weekdays;
+	alarmtime.ampm = time.ampm;
+
+	/*! A_Seconds enables every field from seconds to weekday. */
+	status = PCF85063AT_AlarmToBcd(&alarmtime, A_Seconds, &frame);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	/*! Marked disarmed first, so that a failure below is retried by the next call. */
+	wasArmed = pScheduler->armed;
+	pScheduler->armed = false;
+	status = PCF85063AT_SetAlarmFrame(pScheduler->pSensorHandle, &frame);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	/*! AIE stays set while armed, a re-arm is the alarm registers alone. */
+	if (wasArmed != true)
+	{
+		status = PCF85063AT_UpdateRegister(pScheduler->pSensorHandle, PCF85063AT_CTRL2, PCF85063AT_CTRL2_AIE_MASK,
+				PCF85063AT_CTRL2_AIE_MASK);
+		if (ARM_DRIVER_OK != status)
+		{
+			return SENSOR_ERROR_WRITE;
+		}
+	}
+
+	pScheduler->armed = true;
+	pScheduler->armedEpoch = epoch;
+
+	/*! The alarm only matches when the time moves onto it, check it is still ahead. */
+	status = PCF85063AT_GetEpoch(pScheduler->pSensorHandle, &now);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+	*pMissed = (epoch <= now);
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Alarms_Init(PCF85063AT_alarmscheduler_t *pScheduler, PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	uint32_t id;
+
+	/*! Validate for the correct scheduler and handle.*/
+	if ((pScheduler == NULL) || (pSensorHandle == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	memset(pScheduler, 0, sizeof(PCF85063AT_alarmscheduler_t));
+	pScheduler->pSensorHandle = pSensorHandle;
+	for (id = 0; id < PCF85063AT_ALARM_POOL_SIZE; id++)
+	{
+		PCF85063AT_Alarms_Place(pScheduler, (uint8_t)id, (uint8_t)id);
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Alarms_Insert(PCF85063AT_alarmscheduler_t *pScheduler, uint32_t epoch,
+		PCF85063AT_alarmcallback_t callback, void *pUserData, uint8_t *pId)
+{
+	int32_t status;
+	uint8_t id;
+	bool missed;
+
+	/*! Validate for the correct scheduler, callback and an epoch the RTC can hold.*/
+	if ((pScheduler == NULL) || (callback == NULL) || (epoch < PCF85063AT_EPOCH_2000) || (epoch >= PCF85063AT_EPOCH_2100))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	if (pScheduler->count >= PCF85063AT_ALARM_POOL_SIZE)
+	{
+		return SENSOR_ERROR_BUSY;
+	}
+
+	/*! The first free id sits right past the end of the heap. */
+	id = pScheduler->heap[pScheduler->count];
+	pScheduler->slot[id].epoch = epoch;
+	pScheduler->slot[id].callback = callback;
+	pScheduler->slot[id].pUserData = pUserData;
+	pScheduler->count++;
+	PCF85063AT_Alarms_SiftUp(pScheduler, pScheduler->count - 1);
+
+	if (pId != NULL)
+	{
+		*pId = id;
+	}
+
+	status = PCF85063AT_Alarms_Arm(pScheduler, &missed);
+	if ((SENSOR_ERROR_NONE == status) && missed)
+	{
+		status = PCF85063AT_Alarms_Process(pScheduler);
+	}
+
+	return status;
+}
+
+int32_t PCF85063AT_Alarms_Cancel(PCF85063AT_alarmscheduler_t *pScheduler, uint8_t id)
+{
+	int32_t status;
+	bool missed;
+
+	/*! Validate for the correct scheduler and a scheduled alarm.*/
+	if ((pScheduler == NULL) || (id >= PCF85063AT_ALARM_POOL_SIZE) ||
+			(pScheduler->slot[id].heapIndex >= pScheduler->count))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	PCF85063AT_Alarms_Remove(pScheduler, pScheduler->slot[id].heapIndex);
+
+	status = PCF85063AT_Alarms_Arm(pScheduler, &missed);
+	if ((SENSOR_ERROR_NONE == status) && missed)
+	{
+		status = PCF85063AT_Alarms_Process(pScheduler);
+	}
+
+	return status;
+}
+
+int32_t PCF85063AT_Alarms_Process(PCF85063AT_alarmscheduler_t *pScheduler)
+{
+	int32_t status;
+	uint32_t now;
+	uint32_t fired = 0;
+	bool missed = true;
+
+	/*! Validate for the correct scheduler.*/
+	if ((pScheduler == NULL) || pScheduler->inProcess)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	while (missed)
+	{
+		status = PCF85063AT_GetEpoch(pScheduler->pSensorHandle, &now);
+		if (SENSOR_ERROR_NONE != status)
+		{
+			return status;
+		}
+
+		fired += PCF85063AT_Alarms_Fire(pScheduler, now);
+
+		status = PCF85063AT_Alarms_Arm(pScheduler, &missed);
+		if (SENSOR_ERROR_NONE != status)
+		{
+			return status;
+		}
+	}
+
+	if (fired == 0)
+	{
+		pScheduler->earlyMatches++;
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
+void PCF85063AT_Alarms_OnEvent(PCF85063AT_EVENT event, void *pUserData)
+{
+	PCF85063AT_alarmscheduler_t *pScheduler = (PCF85063AT_alarmscheduler_t *)pUserData;
+
+	if ((pScheduler == NULL) || (event != PCF85063AT_EVENT_ALARM))
+	{
+		return;
+	}
+
+	pScheduler->lastStatus = PCF85063AT_Alarms_Process(pScheduler);
+}
+
+int32_t PCF85063AT_Alarms_GetNext(PCF85063AT_alarmscheduler_t *pScheduler, uint32_t *pEpoch)
+{
+	/*! Validate for the correct scheduler and epoch variable.*/
+	if ((pScheduler == NULL) || (pEpoch == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	if (pScheduler->count == 0)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	*pEpoch = PCF85063AT_ALARMS_EPOCH(pScheduler, 0);
+
+	return SENSOR_ERROR_NONE;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_alarms.h
+ * @brief The pcf85063at_alarms.h file declares a software alarm scheduler of the PCF85063AT RTC.
+ *        Any number of alarms, up to the pool size, share the single hardware alarm: they are kept in a
+ *        min-heap ordered by epoch and only the nearest one is programmed into the RTC.
+ */
+
+#ifndef PCF85063AT_ALARMS_H_
+#define PCF85063AT_ALARMS_H_
+
+#include "pcf85063at_events.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @def    PCF85063AT_ALARM_POOL_SIZE
+ *  @brief  Number of alarms a scheduler can hold, the project may set it. */
+#ifndef PCF85063AT_ALARM_POOL_SIZE
+#define PCF85063AT_ALARM_POOL_SIZE    (32)
+#endif
+
+#if (PCF85063AT_ALARM_POOL_SIZE > 255)
+#error "PCF85063AT_ALARM_POOL_SIZE must fit the uint8_t alarm id"
+#endif
+
+/*! @brief The callback of an alarm, called from PCF85063AT_Alarms_Process() once its epoch is reached.*/
+typedef void (*PCF85063AT_alarmcallback_t)(uint8_t id, uint32_t epoch, void *pUserData);
+
+/*! @brief This structure defines an alarm slot of the pool.*/
+typedef struct
+{
+	uint32_t epoch;                       /*!< Deadline, Unix time.*/
+	PCF85063AT_alarmcallback_t callback;  /*!< Called when the deadline is reached.*/
+	void *pUserData;                      /*!< Parameter passed to callback.*/
+	uint8_t heapIndex;                    /*!< Position in heap, count or more when the slot is free.*/
+} PCF85063AT_alarmslot_t;
+
+/*! @brief This structure defines the alarm scheduler. Statically allocated, no dynamic memory is used.*/
+typedef struct
+{
+	PCF85063AT_sensorhandle_t *pSensorHandle;            /*!< RTC whose alarm is multiplexed.*/
+	PCF85063AT_alarmslot_t slot[PCF85063AT_ALARM_POOL_SIZE]; /*!< Alarm pool, indexed by alarm id.*/
+	uint8_t heap[PCF85063AT_ALARM_POOL_SIZE];            /*!< Ids of the scheduled alarms in heap order, then the free ids.*/
+	uint8_t count;                                       /*!< Number of scheduled alarms.*/
+	bool armed;                                          /*!< The hardware alarm is programmed.*/
+	bool inProcess;                                      /*!< Within PCF85063AT_Alarms_Process(), arming is deferred.*/
+	uint32_t armedEpoch;                                 /*!< Epoch programmed into the hardware alarm.*/
+	uint32_t earlyMatches;                               /*!< AF events before the armed epoch, see PCF85063AT_Alarms_Process().*/
+	int32_t lastStatus;                                  /*!< Status of the last PCF85063AT_Alarms_OnEvent() call.*/
+} PCF85063AT_alarmscheduler_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*! @brief       Initializes the alarm scheduler.
+ *  @details     The pool is emptied, the hardware alarm is left untouched until the first alarm is inserted.
+ *  @param[in]   pScheduler  		Pointer to the scheduler.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @constraints Call after PCF85063AT_Initialize().
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Alarms_Init() returns the status.
+ */
+int32_t PCF85063AT_Alarms_Init(PCF85063AT_alarmscheduler_t *pScheduler, PCF85063AT_sensorhandle_t *pSensorHandle);
+
+/*! @brief       Schedules an alarm.
+ *  @details     O(log n). The hardware alarm is reprogrammed only when the new alarm is the nearest one.
+ *               An epoch already reached fires on the next PCF85063AT_Alarms_Process() call.
+ *  @param[in]   pScheduler  		Pointer to the scheduler.
+ *  @param[in]   epoch  			Deadline, Unix time from PCF85063AT_EPOCH_2000 to PCF85063AT_EPOCH_2100 - 1.
+ *  @param[in]   callback  			Called when the deadline is reached.
+ *  @param[in]   pUserData  		Parameter passed to callback.
+ *  @param[out]  pId  				Id of the alarm, valid until it fires or is cancelled. May be NULL.
+ *  @constraints Call from task context, may be called from an alarm callback.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Alarms_Insert() returns SENSOR_ERROR_BUSY when the pool is full.
+ */
+int32_t PCF85063AT_Alarms_Insert(PCF85063AT_alarmscheduler_t *pScheduler, uint32_t epoch,
+		PCF85063AT_alarmcallback_t callback, void *pUserData, uint8_t *pId);
+
+/*! @brief       Cancels an alarm.
+ *  @details     O(log n). The hardware alarm is reprogrammed when the nearest alarm is cancelled, and disabled
+ *               when none is left.
+ *  @param[in]   pScheduler  		Pointer to the scheduler.
+ *  @param[in]   id  				Id returned by PCF85063AT_Alarms_Insert().
+ *  @constraints Call from task context, may be called from an alarm callback.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Alarms_Cancel() returns SENSOR_ERROR_INVALID_PARAM when the alarm is not scheduled.
+ */
+int32_t PCF85063AT_Alarms_Cancel(PCF85063AT_alarmscheduler_t *pScheduler, uint8_t id);
+
+/*! @brief       Fires the alarms whose deadline is reached and arms the next one.
+ *  @details     Reads the epoch, calls the callback of every due alarm in deadline order, then programs the
+ *               nearest remaining alarm. The hardware alarm has no month or year field, so a deadline 4 weeks
+ *               or more away may match early: such an AF event fires nothing and is counted in earlyMatches.
+ *  @param[in]   pScheduler  		Pointer to the scheduler.
+ *  @constraints Call from task context on the alarm event, once AF is cleared, see PCF85063AT_Alarms_OnEvent().
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Alarms_Process() returns the status.
+ */
+int32_t PCF85063AT_Alarms_Process(PCF85063AT_alarmscheduler_t *pScheduler);
+
+/*! @brief       Event handler calling PCF85063AT_Alarms_Process().
+ *  @details     Register it for PCF85063AT_EVENT_ALARM with the scheduler as user data, the dispatcher clears
+ *               AF before calling it. The status is kept in lastStatus.
+ *  @param[in]   event  			Event dispatched.
+ *  @param[in]   pUserData  		Pointer to the scheduler.
+ *  @constraints None
+ *  @reentrant   No
+ */
+void PCF85063AT_Alarms_OnEvent(PCF85063AT_EVENT event, void *pUserData);
+
+/*! @brief       Gets the nearest deadline, e.g. to sleep until it.
+ *  @param[in]   pScheduler  		Pointer to the scheduler.
+ *  @param[out]  pEpoch  			Nearest deadline.
+ *  @constraints None
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Alarms_GetNext() returns SENSOR_ERROR_INIT when no alarm is scheduled.
+ */
+int32_t PCF85063AT_Alarms_GetNext(PCF85063AT_alarmscheduler_t *pScheduler, uint32_t *pEpoch);
+
+#endif /* PCF85063AT_ALARMS_H_ */
@@ -0,0 +1,346 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * pcf85063at_calib.c
+ *
+ * @file pcf85063at_calib.c
+ * @brief The pcf85063at_calib.c file implements the drift calibration of the PCF85063AT RTC.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+
+#include "pcf85063at_calib.h"
+#include "systick_utils.h"
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+
+/*! Correction of an Offset register value, 7 bit two's complement OFFSET times the step of MODE. */
+static int32_t PCF85063AT_Calib_OffsetToPpb(uint8_t offsetReg)
+{
+	int32_t value = (int32_t)(int8_t)(uint8_t)(offsetReg << 1) >> 1;
+
+	return value * ((offsetReg & PCF85063AT_OFFSET_MODE_MASK) ? PCF85063AT_CALIB_STEP_COURSE_PPB :
+			PCF85063AT_CALIB_STEP_NORMAL_PPB);
+}
+
+/*! Checksum of a record, ones' complement of the sum of the bytes before checksum. */
+static uint16_t PCF85063AT_Calib_Checksum(const PCF85063AT_calibrecord_t *pRecord)
+{
+	const uint8_t *pByte = (const uint8_t *)pRecord;
+	uint16_t sum = 0;
+	uint32_t i;
+
+	for (i = 0; i < offsetof(PCF85063AT_calibrecord_t, checksum); i++)
+	{
+		sum += pByte[i];
+	}
+
+	return (uint16_t)~sum;
+}
+
+/*! Program the Offset register, MODE and OFFSET in a single write. */
+static int32_t PCF85063AT_Calib_Apply(PCF85063AT_calibration_t *pCalib, uint8_t offsetReg)
+{
+	int32_t status;
+
+	status = PCF85063AT_UpdateRegister(pCalib->pSensorHandle, PCF85063AT_OFFSET, offsetReg,
+			PCF85063AT_OFFSET_MODE_MASK | PCF85063AT_OFFSET_MASK);
+	if (ARM_DRIVER_OK != status)
+	{
+		return SENSOR_ERROR_WRITE;
+	}
+
+	pCalib->offsetReg = offsetReg;
+	pCalib->correctionPpb = PCF85063AT_Calib_OffsetToPpb(offsetReg);
+
+	return SENSOR_ERROR_NONE;
+}
+
+/*! Save the record of a converged calibration. */
+static int32_t PCF85063AT_Calib_Store(PCF85063AT_calibration_t *pCalib)
+{
+	PCF85063AT_calibrecord_t record;
+
+	if (pCalib->store == NULL)
+	{
+		return SENSOR_ERROR_NONE;
+	}
+
+	memset(&record, 0, sizeof(record));
+	record.magic = PCF85063AT_CALIB_MAGIC;
+	record.correctionPpb = pCalib->correctionPpb;
+	record.residualPpb = pCalib->residualPpb;
+	record.offsetReg = pCalib->offsetReg;
+	record.iterations = pCalib->iterations;
+	record.checksum = PCF85063AT_Calib_Checksum(&record);
+
+	return pCalib->store(&record, pCalib->pStorageUserData);
+}
+
+int32_t PCF85063AT_Calib_Init(PCF85063AT_calibration_t *pCalib, PCF85063AT_sensorhandle_t *pSensorHandle,
+		uint32_t refHz, uint32_t minWindowS)
+{
+	int32_t status;
+	uint8_t offsetReg;
+
+	/*! Validate for the correct calibration, handle and reference.*/
+	if ((pCalib == NULL) || (pSensorHandle == NULL) || (refHz == 0))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	memset(pCalib, 0, sizeof(*pCalib));
+	pCalib->pSensorHandle = pSensorHandle;
+	pCalib->refHz = refHz;
+	pCalib->minWindowS = minWindowS;
+
+	status = PCF85063AT_Get_Offset(pSensorHandle, &offsetReg);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+	pCalib->offsetReg = offsetReg;
+	pCalib->correctionPpb = PCF85063AT_Calib_OffsetToPpb(offsetReg);
+
+	return SENSOR_ERROR_NONE;
+}
+
+void PCF85063AT_Calib_SetStorage(PCF85063AT_calibration_t *pCalib, PCF85063AT_calibstore_t store,
+		PCF85063AT_calibload_t load, void *pUserData)
+{
+	if (pCalib == NULL)
+	{
+		return;
+	}
+
+	pCalib->store = store;
+	pCalib->load = load;
+	pCalib->pStorageUserData = pUserData;
+}
+
+int32_t PCF85063AT_Calib_Restore(PCF85063AT_calibration_t *pCalib)
+{
+	int32_t status;
+	PCF85063AT_calibrecord_t record;
+
+	/*! Validate for the correct calibration.*/
+	if ((pCalib == NULL) || (pCalib->pSensorHandle == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! A record which is missing, torn or of another layout is ignored. */
+	if ((pCalib->load == NULL) || (SENSOR_ERROR_NONE != pCalib->load(&record, pCalib->pStorageUserData)) ||
+			(record.magic != PCF85063AT_CALIB_MAGIC) || (record.checksum != PCF85063AT_Calib_Checksum(&record)))
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	status = PCF85063AT_Calib_Apply(pCalib, record.offsetReg);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+	pCalib->residualPpb = record.residualPpb;
+	pCalib->iterations = record.iterations;
+	pCalib->converged = true;
+	pCalib->started = false;
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Calib_SampleSysTick(PCF85063AT_timebase_t *pTimebase, PCF85063AT_sensorhandle_t *pSensorHandle,
+		PCF85063AT_calibsample_t *pSample)
+{
+	int32_t status;
+
+	/*! Validate for the correct sample.*/
+	if (pSample == NULL)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	status = PCF85063AT_Timebase_Sync(pTimebase, pSensorHandle);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	/*! The anchor is a seconds edge, the RTC time is a whole second. */
+	pSample->rtcUs = (uint64_t)pTimebase->epoch * 1000000U;
+	pSample->refTicks = pTimebase->tick;
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Calib_SampleHost(PCF85063AT_timebase_t *pTimebase, PCF85063AT_sensorhandle_t *pSensorHandle,
+		uint64_t hostUs, uint64_t receivedTick, PCF85063AT_calibsample_t *pSample)
+{
+	int32_t status;
+	int64_t ticks;
+
+	/*! Validate for the correct sample.*/
+	if (pSample == NULL)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	status = PCF85063AT_Timebase_Sync(pTimebase, pSensorHandle);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	/*! From the seconds edge back to the reception, a few seconds of core clock error are negligible. */
+	ticks = (int64_t)(receivedTick - pTimebase->tick);
+	pSample->rtcUs = (uint64_t)((int64_t)((uint64_t)pTimebase->epoch * 1000000U) +
+			ticks * 1000000 / (int64_t)pTimebase->ticksPerSecond);
+	pSample->refTicks = hostUs;
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Calib_Compute(int32_t correctionPpb, uint8_t *pOffsetReg, int32_t *pResidualPpb)
+{
+	static const int32_t s_step[2] = {PCF85063AT_CALIB_STEP_NORMAL_PPB, PCF85063AT_CALIB_STEP_COURSE_PPB};
+	int32_t value, residual, bestResidual = 0;
+	uint32_t bestAbs = UINT32_MAX;
+	uint32_t mode;
+
+	/*! Validate for the correct Offset register variable.*/
+	if (pOffsetReg == NULL)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	for (mode = normal_mode; mode <= course_mode; mode++)
+	{
+		/*! Rounded to the nearest step, clamped to the 7 bit OFFSET. */
+		value = (correctionPpb + ((correctionPpb < 0) ? -(s_step[mode] / 2) : (s_step[mode] / 2))) / s_step[mode];
+		if (value < -64)
+		{
+			value = -64;
+		}
+		else if (value > 63)
+		{
+			value = 63;
+		}
+
+		residual = correctionPpb - value * s_step[mode];
+		if ((uint32_t)((residual < 0) ? -residual : residual) < bestAbs)
+		{
+			bestAbs = (uint32_t)((residual < 0) ? -residual : residual);
+			bestResidual = residual;
+			*pOffsetReg = (uint8_t)((mode << PCF85063AT_OFFSET_MODE_SHIFT) | ((uint32_t)value & PCF85063AT_OFFSET_MASK));
+		}
+	}
+
+	if (pResidualPpb != NULL)
+	{
+		*pResidualPpb = bestResidual;
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Calib_Update(PCF85063AT_calibration_t *pCalib, const PCF85063AT_calibsample_t *pSample)
+{
+	int32_t status;
+	uint64_t rtcUs, refUs, windowUs, refTicks;
+	int64_t drift;
+	int32_t residual;
+	uint8_t offsetReg;
+
+	/*! Validate for the correct calibration and sample.*/
+	if ((pCalib == NULL) || (pCalib->pSensorHandle == NULL) || (pSample == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	if (!pCalib->started)
+	{
+		pCalib->start = *pSample;
+		pCalib->started = true;
+		return SENSOR_ERROR_NONE;
+	}
+
+	/*! Points must move forward on both clocks. */
+	if ((pSample->rtcUs <= pCalib->start.rtcUs) || (pSample->refTicks <= pCalib->start.refTicks))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+	rtcUs = pSample->rtcUs - pCalib->start.rtcUs;
+
+	/*! Corrections are applied once per interval, the window spans several of them. */
+	windowUs = (uint64_t)pCalib->minWindowS * 1000000U;
+	if (pCalib->offsetReg & PCF85063AT_OFFSET_MASK)
+	{
+		refUs = (uint64_t)PCF85063AT_CALIB_INTERVALS * 1000000U *
+				((pCalib->offsetReg & PCF85063AT_OFFSET_MODE_MASK) ? PCF85063AT_CALIB_INTERVAL_COURSE_S :
+						PCF85063AT_CALIB_INTERVAL_NORMAL_S);
+		if (refUs > windowUs)
+		{
+			windowUs = refUs;
+		}
+	}
+	if (rtcUs < windowUs)
+	{
+		return SENSOR_ERROR_BUSY;
+	}
+
+	/*! Reference span in microseconds, split so that the product does not overflow. */
+	refTicks = pSample->refTicks - pCalib->start.refTicks;
+	refUs = (refTicks / pCalib->refHz) * 1000000U + ((refTicks % pCalib->refHz) * 1000000U) / pCalib->refHz;
+	if (refUs == 0)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	drift = ((int64_t)rtcUs - (int64_t)refUs) * 1000000000 / (int64_t)refUs;
+	if (drift > INT32_MAX / 2)
+	{
+		drift = INT32_MAX / 2;
+	}
+	else if (drift < -(INT32_MAX / 2))
+	{
+		drift = -(INT32_MAX / 2);
+	}
+	pCalib->driftPpb = (int32_t)drift;
+
+	/*! The drift includes the programmed correction, the new one cancels what is left. */
+	status = PCF85063AT_Calib_Compute(pCalib->correctionPpb - pCalib->driftPpb, &offsetReg, &residual);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+	pCalib->start = *pSample;
+	if (pCalib->iterations < UINT8_MAX)
+	{
+		pCalib->iterations++;
+	}
+	pCalib->residualPpb = -residual;
+
+	if (offsetReg == pCalib->offsetReg)
+	{
+		if (pCalib->converged)
+		{
+			return SENSOR_ERROR_NONE;
+		}
+		pCalib->converged = true;
+		return PCF85063AT_Calib_Store(pCalib);
+	}
+
+	pCalib->converged = false;
+	return PCF85063AT_Calib_Apply(pCalib, offsetReg);
+}
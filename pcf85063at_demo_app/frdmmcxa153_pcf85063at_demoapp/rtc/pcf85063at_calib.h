@@ -0,0 +1,188 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_calib.h
+ * @brief The pcf85063at_calib.h file declares the drift calibration of the PCF85063AT RTC.
+ *        The drift is measured against a reference clock over a window, the Offset register is set to cancel
+ *        it and the next window measures the result, until the Offset register no longer changes.
+ */
+
+#ifndef PCF85063AT_CALIB_H_
+#define PCF85063AT_CALIB_H_
+
+#include "pcf85063at_timebase.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @def    PCF85063AT_CALIB_STEP_NORMAL_PPB
+ *  @brief  Correction of one OFFSET step in normal mode, in parts per billion. */
+#define PCF85063AT_CALIB_STEP_NORMAL_PPB    (4340)
+
+/*! @def    PCF85063AT_CALIB_STEP_COURSE_PPB
+ *  @brief  Correction of one OFFSET step in course mode, in parts per billion. */
+#define PCF85063AT_CALIB_STEP_COURSE_PPB    (4069)
+
+/*! @def    PCF85063AT_CALIB_INTERVAL_NORMAL_S
+ *  @brief  Seconds between two corrections in normal mode. */
+#define PCF85063AT_CALIB_INTERVAL_NORMAL_S    (7200U)
+
+/*! @def    PCF85063AT_CALIB_INTERVAL_COURSE_S
+ *  @brief  Seconds between two corrections in course mode. */
+#define PCF85063AT_CALIB_INTERVAL_COURSE_S    (240U)
+
+/*! @def    PCF85063AT_CALIB_INTERVALS
+ *  @brief  Correction intervals a window spans at least once OFFSET is set, the project may set it.
+ *          A window catches one correction more or less than its length gives, so the error of the
+ *          measured correction is at most 1 / PCF85063AT_CALIB_INTERVALS of it. */
+#ifndef PCF85063AT_CALIB_INTERVALS
+#define PCF85063AT_CALIB_INTERVALS    (4U)
+#endif
+
+/*! @def    PCF85063AT_CALIB_MAGIC
+ *  @brief  First word of a valid calibration record. */
+#define PCF85063AT_CALIB_MAGIC    (0x31424C43U)
+
+/*! @brief This structure defines a measurement point: the RTC time and the reference clock at the same instant.*/
+typedef struct
+{
+	uint64_t rtcUs;          /*!< RTC time in microseconds.*/
+	uint64_t refTicks;       /*!< Reference clock count.*/
+} PCF85063AT_calibsample_t;
+
+/*! @brief This structure defines the calibration record kept by the application across resets.*/
+typedef struct
+{
+	uint32_t magic;          /*!< PCF85063AT_CALIB_MAGIC.*/
+	int32_t  correctionPpb;  /*!< Correction of offsetReg.*/
+	int32_t  residualPpb;    /*!< Drift expected with offsetReg.*/
+	uint8_t  offsetReg;      /*!< Offset register, MODE and OFFSET.*/
+	uint8_t  iterations;     /*!< Windows measured to converge.*/
+	uint16_t checksum;       /*!< Ones' complement of the sum of the bytes before it.*/
+} PCF85063AT_calibrecord_t;
+
+/*! @brief Saves the calibration record, e.g. to flash. Returns SENSOR_ERROR_NONE on success.*/
+typedef int32_t (*PCF85063AT_calibstore_t)(const PCF85063AT_calibrecord_t *pRecord, void *pUserData);
+
+/*! @brief Loads the calibration record saved last. Returns SENSOR_ERROR_NONE on success.*/
+typedef int32_t (*PCF85063AT_calibload_t)(PCF85063AT_calibrecord_t *pRecord, void *pUserData);
+
+/*! @brief This structure defines the calibration state.*/
+typedef struct
+{
+	PCF85063AT_sensorhandle_t *pSensorHandle;  /*!< RTC being calibrated.*/
+	uint32_t refHz;                            /*!< Frequency of the reference clock.*/
+	uint32_t minWindowS;                       /*!< Shortest window, in RTC seconds.*/
+	PCF85063AT_calibsample_t start;            /*!< First point of the current window.*/
+	bool started;                              /*!< start is valid.*/
+	uint8_t offsetReg;                         /*!< Offset register programmed.*/
+	int32_t correctionPpb;                     /*!< Correction of offsetReg, positive speeds the RTC up.*/
+	int32_t driftPpb;                          /*!< Drift measured over the last window, positive when the RTC is fast.*/
+	int32_t residualPpb;                       /*!< Drift expected with offsetReg.*/
+	uint8_t iterations;                        /*!< Windows measured.*/
+	bool converged;                            /*!< The last window left offsetReg unchanged.*/
+	PCF85063AT_calibstore_t store;             /*!< Saves the record once converged, may be NULL.*/
+	PCF85063AT_calibload_t load;               /*!< Loads the record, may be NULL.*/
+	void *pStorageUserData;                    /*!< Parameter passed to store and load.*/
+} PCF85063AT_calibration_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*! @brief       Initializes the calibration.
+ *  @details     Reads the Offset register, the drift measured next includes its correction.
+ *  @param[in]   pCalib  			Pointer to the calibration.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   refHz  			Frequency of the reference clock: the SysTick frequency for
+ *  								PCF85063AT_Calib_SampleSysTick(), 1000000 for host timestamps in microseconds.
+ *  @param[in]   minWindowS  		Shortest window in seconds. A window edge is placed within one burst read,
+ *  								about 1 ms, so 1000 s resolve 1 ppm.
+ *  @constraints Call after PCF85063AT_Initialize().
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Calib_Init() returns the status.
+ */
+int32_t PCF85063AT_Calib_Init(PCF85063AT_calibration_t *pCalib, PCF85063AT_sensorhandle_t *pSensorHandle,
+		uint32_t refHz, uint32_t minWindowS);
+
+/*! @brief       Sets the functions keeping the calibration record across resets.
+ *  @details     The Offset register survives MCU resets while the RTC is powered, the record restores it
+ *               after a power loss or PCF85063AT_SwRst().
+ *  @param[in]   pCalib  			Pointer to the calibration.
+ *  @param[in]   store  			Saves the record, called once the calibration converges. May be NULL.
+ *  @param[in]   load  				Loads the record, called by PCF85063AT_Calib_Restore(). May be NULL.
+ *  @param[in]   pUserData  		Parameter passed to store and load.
+ *  @constraints None
+ *  @reentrant   No
+ */
+void PCF85063AT_Calib_SetStorage(PCF85063AT_calibration_t *pCalib, PCF85063AT_calibstore_t store,
+		PCF85063AT_calibload_t load, void *pUserData);
+
+/*! @brief       Programs the Offset register from the saved record.
+ *  @param[in]   pCalib  			Pointer to the calibration.
+ *  @constraints Call after PCF85063AT_Calib_Init().
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Calib_Restore() returns SENSOR_ERROR_INIT when there is no valid record.
+ */
+int32_t PCF85063AT_Calib_Restore(PCF85063AT_calibration_t *pCalib);
+
+/*! @brief       Takes a measurement point against the SysTick.
+ *  @details     Waits for a seconds edge of the RTC with PCF85063AT_Timebase_Sync(), up to one second. The
+ *               SysTick is as accurate as the core clock: use a crystal, not the internal oscillator.
+ *  @param[in]   pTimebase  		Pointer to the timebase, initialized with the SysTick frequency.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[out]  pSample  			Pointer to the measurement point.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Calib_SampleSysTick() returns the status.
+ */
+int32_t PCF85063AT_Calib_SampleSysTick(PCF85063AT_timebase_t *pTimebase, PCF85063AT_sensorhandle_t *pSensorHandle,
+		PCF85063AT_calibsample_t *pSample);
+
+/*! @brief       Takes a measurement point against a host timestamp.
+ *  @details     Waits for a seconds edge of the RTC with PCF85063AT_Timebase_Sync() and moves it to the instant
+ *               the timestamp was received with the SysTick, over a few seconds at most.
+ *  @param[in]   pTimebase  		Pointer to the timebase, initialized with the SysTick frequency.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   hostUs  			Host timestamp in microseconds, e.g. from NTP or GPS.
+ *  @param[in]   receivedTick  		BOARD_SystickGetTicks64() when the timestamp was received.
+ *  @param[out]  pSample  			Pointer to the measurement point, for a calibration with refHz 1000000.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Calib_SampleHost() returns the status.
+ */
+int32_t PCF85063AT_Calib_SampleHost(PCF85063AT_timebase_t *pTimebase, PCF85063AT_sensorhandle_t *pSensorHandle,
+		uint64_t hostUs, uint64_t receivedTick, PCF85063AT_calibsample_t *pSample);
+
+/*! @brief       Computes the Offset register closest to a correction.
+ *  @details     Rounds the correction to 4.34 ppm steps in normal mode and to 4.069 ppm steps in course mode,
+ *               OFFSET from -64 to 63, and keeps the mode with the smallest residual, normal mode on a tie.
+ *               Integer arithmetic only.
+ *  @param[in]   correctionPpb  	Correction wanted, positive speeds the RTC up.
+ *  @param[out]  pOffsetReg  		Pointer to the Offset register value.
+ *  @param[out]  pResidualPpb  		Pointer to the correction wanted minus the one given. May be NULL.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_Calib_Compute() returns the status.
+ */
+int32_t PCF85063AT_Calib_Compute(int32_t correctionPpb, uint8_t *pOffsetReg, int32_t *pResidualPpb);
+
+/*! @brief       Feeds a measurement point to the calibration.
+ *  @details     The first point opens a window. A later point closes it once it spans minWindowS and,
+ *               with OFFSET set, PCF85063AT_CALIB_INTERVALS correction intervals: the drift is measured,
+ *               the Offset register is set to cancel it and a new window opens at this point. When the Offset
+ *               register is left unchanged the calibration has converged and the record is stored.
+ *  @param[in]   pCalib  			Pointer to the calibration.
+ *  @param[in]   pSample  			Pointer to the measurement point.
+ *  @constraints Call after PCF85063AT_Calib_Init(), with points of one reference clock.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Calib_Update() returns SENSOR_ERROR_BUSY while the window is too short.
+ */
+int32_t PCF85063AT_Calib_Update(PCF85063AT_calibration_t *pCalib, const PCF85063AT_calibsample_t *pSample);
+
+#endif /* PCF85063AT_CALIB_H_ */
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_events.h
+ * @brief The pcf85063at_events.h file declares the INTB event dispatcher of the PCF85063AT RTC.
+ *        The interrupt only records the edge, the flags are read, dispatched and cleared from task context.
+ */
+
+#ifndef PCF85063AT_EVENTS_H_
+#define PCF85063AT_EVENTS_H_
+
+#include "pcf85063at_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*--------------------------------
+ ** Enum: PCF85063AT_EVENT
+ ** @brief: Events decoded from Control_2
+ ** ------------------------------*/
+typedef enum PCF85063AT_EVENT
+{
+	PCF85063AT_EVENT_ALARM = 0x00,        /* AF set */
+	PCF85063AT_EVENT_MINUTE = 0x01,       /* TF set with MI enabled */
+	PCF85063AT_EVENT_HALF_MINUTE = 0x02,  /* TF set with HMI enabled */
+	PCF85063AT_EVENT_TIMER = 0x03,        /* TF set with TE and TIE enabled, or TE with MI and HMI disabled */
+	PCF85063AT_EVENT_COUNT = 0x04,
+}PCF85063AT_EVENT;
+
+/*! @brief The handler of an event, called from PCF85063AT_Event_Process().*/
+typedef void (*PCF85063AT_eventhandler_t)(PCF85063AT_EVENT event, void *pUserData);
+
+/*! @brief This structure defines the interrupt to handler latency of an event, in systicks.*/
+typedef struct
+{
+	uint32_t count;          /*!< Number of dispatches.*/
+	uint32_t lastLatency;    /*!< Latency of the last dispatch.*/
+	uint32_t maxLatency;     /*!< Longest latency.*/
+	uint32_t totalLatency;   /*!< Sum of the latencies, wraps.*/
+} PCF85063AT_eventstats_t;
+
+/*! @brief This structure defines the event dispatcher.*/
+typedef struct
+{
+	PCF85063AT_sensorhandle_t *pSensorHandle;                   /*!< RTC the events come from.*/
+	PCF85063AT_eventhandler_t handler[PCF85063AT_EVENT_COUNT];  /*!< Registered handlers, NULL when none.*/
+	void *pUserData[PCF85063AT_EVENT_COUNT];                    /*!< Parameters passed to the handlers.*/
+	volatile uint32_t pending;                                  /*!< INTB edges not processed yet.*/
+	volatile uint32_t isrTick;                                  /*!< Systick count of the first pending edge.*/
+	PCF85063AT_eventstats_t stats[PCF85063AT_EVENT_COUNT];      /*!< Latency counters per event.*/
+	uint32_t spurious;                                          /*!< Edges processed with no flag set.*/
+} PCF85063AT_eventdispatcher_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*! @brief       Initializes the event dispatcher.
+ *  @param[in]   pDispatcher  		Pointer to the dispatcher.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @constraints Call after PCF85063AT_Initialize() and before INTB is enabled.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Event_Init() returns the status.
+ */
+int32_t PCF85063AT_Event_Init(PCF85063AT_eventdispatcher_t *pDispatcher, PCF85063AT_sensorhandle_t *pSensorHandle);
+
+/*! @brief       Registers the handler of an event.
+ *  @param[in]   pDispatcher  		Pointer to the dispatcher.
+ *  @param[in]   event  			Event to handle.
+ *  @param[in]   handler  			Handler, NULL to unregister. Flags of unhandled events are still cleared.
+ *  @param[in]   pUserData  		Parameter passed to handler.
+ *  @constraints None
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Event_Register() returns the status.
+ */
+int32_t PCF85063AT_Event_Register(PCF85063AT_eventdispatcher_t *pDispatcher, PCF85063AT_EVENT event,
+		PCF85063AT_eventhandler_t handler, void *pUserData);
+
+/*! @brief       Records an INTB edge.
+ *  @details     Call from the INTB interrupt. Only latches the systick count for the latency counters,
+ *               no bus access.
+ *  @param[in]   pDispatcher  		Pointer to the dispatcher.
+ *  @constraints None
+ *  @reentrant   Yes
+ */
+void PCF85063AT_Event_OnInterrupt(PCF85063AT_eventdispatcher_t *pDispatcher);
+
+/*! @brief       Dispatches the pending events.
+ *  @details     Reads Control_2 once, calls the handler of every event whose flag is set and clears the
+ *               serviced flags in a single write. TF does not tell its source apart: when it is set, Timer_mode
+ *               is read too (from the shadow once known) and every enabled TF source is reported, so a
+ *               minute or half minute handler may be called on a countdown timer period and the reverse.
+ *  @param[in]   pDispatcher  		Pointer to the dispatcher.
+ *  @param[in]   force  			Read Control_2 even if no INTB edge was recorded, e.g. to poll the flags.
+ *  @constraints Call from task context.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Event_Process() returns the status.
+ */
+int32_t PCF85063AT_Event_Process(PCF85063AT_eventdispatcher_t *pDispatcher, bool force);
+
+/*! @brief       Gets the latency counters of an event.
+ *  @param[in]   pDispatcher  		Pointer to the dispatcher.
+ *  @param[in]   event  			Event.
+ *  @param[out]  pStats  			Pointer to the counters.
+ *  @constraints None
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Event_GetStats() returns the status.
+ */
+int32_t PCF85063AT_Event_GetStats(PCF85063AT_eventdispatcher_t *pDispatcher, PCF85063AT_EVENT event,
+		PCF85063AT_eventstats_t *pStats);
+
+#endif /* PCF85063AT_EVENTS_H_ */
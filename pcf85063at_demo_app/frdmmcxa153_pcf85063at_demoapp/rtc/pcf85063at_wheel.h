@@ -0,0 +1,152 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_wheel.h
+ * @brief The pcf85063at_wheel.h file declares a hierarchical timer wheel of the PCF85063AT RTC.
+ *        Any number of periodic and one-shot software timers share the countdown timer, which is loaded for
+ *        the soonest expiry only, so that the MCU sleeps between expiries.
+ */
+
+#ifndef PCF85063AT_WHEEL_H_
+#define PCF85063AT_WHEEL_H_
+
+#include "pcf85063at_events.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @def    PCF85063AT_WHEEL_TICK_HZ
+ *  @brief  Resolution of the wheel, the 64 Hz source clock of the countdown timer. */
+#define PCF85063AT_WHEEL_TICK_HZ    (64)
+
+/*! @def    PCF85063AT_WHEEL_LEVELS
+ *  @brief  Number of levels, each one 64 times coarser than the one below. */
+#define PCF85063AT_WHEEL_LEVELS    (4)
+
+/*! @def    PCF85063AT_WHEEL_SLOT_BITS
+ *  @brief  log2 of the number of slots per level. */
+#define PCF85063AT_WHEEL_SLOT_BITS    (6)
+
+/*! @def    PCF85063AT_WHEEL_SLOTS
+ *  @brief  Number of slots per level, one bit each in the occupancy bitmap. */
+#define PCF85063AT_WHEEL_SLOTS    (1U << PCF85063AT_WHEEL_SLOT_BITS)
+
+/*! @def    PCF85063AT_WHEEL_MAX_TICKS
+ *  @brief  Longest timeout or period, about 388 days. */
+#define PCF85063AT_WHEEL_MAX_TICKS    (0x7FFFFFFFU)
+
+struct PCF85063AT_swtimer;
+
+/*! @brief The callback of a software timer, called from PCF85063AT_Wheel_Process() when it expires.*/
+typedef void (*PCF85063AT_swtimercallback_t)(struct PCF85063AT_swtimer *pTimer, void *pUserData);
+
+/*! @brief This structure defines a software timer. Owned by the application, linked into the wheel while running.*/
+typedef struct PCF85063AT_swtimer
+{
+	struct PCF85063AT_swtimer *pNext;       /*!< Next timer of the slot.*/
+	struct PCF85063AT_swtimer **ppPrev;     /*!< Link pointing to this timer, NULL when stopped.*/
+	uint32_t expires;                       /*!< Wheel tick of the expiry.*/
+	uint32_t period;                        /*!< Ticks between expiries, 0 for a one-shot timer.*/
+	PCF85063AT_swtimercallback_t callback;  /*!< Called on expiry.*/
+	void *pUserData;                        /*!< Parameter passed to callback.*/
+	uint8_t level;                          /*!< Level of the slot the timer is linked into.*/
+	uint8_t slot;                           /*!< Slot the timer is linked into.*/
+} PCF85063AT_swtimer_t;
+
+/*! @brief This structure defines the timer wheel.*/
+typedef struct
+{
+	PCF85063AT_sensorhandle_t *pSensorHandle;                                   /*!< RTC whose countdown timer is multiplexed.*/
+	PCF85063AT_swtimer_t *slot[PCF85063AT_WHEEL_LEVELS][PCF85063AT_WHEEL_SLOTS]; /*!< Timers per slot.*/
+	uint32_t occupied[PCF85063AT_WHEEL_LEVELS][2];                               /*!< Bitmap of the non-empty slots.*/
+	uint32_t now;                                                                /*!< Wheel tick of the last expiry.*/
+	uint32_t count;                                                              /*!< Number of running timers.*/
+	uint32_t anchorEpoch;                                                        /*!< RTC second at wheel tick 0.*/
+	uint32_t programmed;                                                         /*!< Ticks the countdown timer is loaded with, 0 when stopped.*/
+	TCF tcf;                                                                     /*!< Source clock the countdown timer runs on.*/
+	uint8_t value;                                                               /*!< Value the countdown timer is loaded with.*/
+	bool inProcess;                                                              /*!< Within PCF85063AT_Wheel_Process(), loading is deferred.*/
+	uint32_t expiries;                                                           /*!< Countdown timer expiries processed.*/
+	uint32_t loads;                                                              /*!< Countdown timer loads.*/
+	int32_t lastStatus;                                                          /*!< Status of the last PCF85063AT_Wheel_OnEvent() call.*/
+} PCF85063AT_timerwheel_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*! @brief       Initializes the timer wheel.
+ *  @details     Anchors wheel tick 0 on the current RTC second and stops the countdown timer.
+ *  @param[in]   pWheel  			Pointer to the wheel.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @constraints Call after PCF85063AT_Initialize(). The minute and half minute interrupts must stay disabled,
+ *               they share TF with the countdown timer.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Wheel_Init() returns the status.
+ */
+int32_t PCF85063AT_Wheel_Init(PCF85063AT_timerwheel_t *pWheel, PCF85063AT_sensorhandle_t *pSensorHandle);
+
+/*! @brief       Starts a software timer, restarting it when it runs.
+ *  @details     O(1). Within a callback the timeout counts from the expiry being processed, otherwise from the
+ *               current tick, read from the countdown value of the load under way: exact on the 64 Hz source
+ *               clock, within one second on a coarser one, the other timers keeping their expiries. The
+ *               countdown timer is reloaded only when the new expiry is the soonest.
+ *  @param[in]   pWheel  			Pointer to the wheel.
+ *  @param[in]   pTimer  			Pointer to the timer, kept by the wheel until it is stopped or expires.
+ *  @param[in]   ticks  			Ticks of PCF85063AT_WHEEL_TICK_HZ until the first expiry, 1 to PCF85063AT_WHEEL_MAX_TICKS.
+ *  @param[in]   period  			Ticks between later expiries, 0 for a one-shot timer.
+ *  @param[in]   callback  			Called on expiry.
+ *  @param[in]   pUserData  		Parameter passed to callback.
+ *  @constraints Call from task context, may be called from a timer callback.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Wheel_Start() returns the status.
+ */
+int32_t PCF85063AT_Wheel_Start(PCF85063AT_timerwheel_t *pWheel, PCF85063AT_swtimer_t *pTimer, uint32_t ticks,
+		uint32_t period, PCF85063AT_swtimercallback_t callback, void *pUserData);
+
+/*! @brief       Stops a software timer.
+ *  @details     O(1). The countdown timer is left loaded, the wake it causes finds nothing to expire; only
+ *               stopping the last timer accesses the bus, to stop the countdown timer.
+ *  @param[in]   pWheel  			Pointer to the wheel.
+ *  @param[in]   pTimer  			Pointer to the timer.
+ *  @constraints Call from task context, may be called from a timer callback.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Wheel_Stop() returns the status.
+ */
+int32_t PCF85063AT_Wheel_Stop(PCF85063AT_timerwheel_t *pWheel, PCF85063AT_swtimer_t *pTimer);
+
+/*! @brief       Tells whether a software timer runs.
+ *  @param[in]   pTimer  			Pointer to the timer.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      bool true while the timer is linked into a wheel.
+ */
+bool PCF85063AT_Wheel_IsRunning(const PCF85063AT_swtimer_t *pTimer);
+
+/*! @brief       Expires the timers due at the countdown timer expiry and reloads it for the next one.
+ *  @details     Moves the wheel by the ticks the countdown timer was loaded with, calls the callbacks of the
+ *               expired timers and restarts the periodic ones. When the soonest expiry is as far as the last
+ *               one, the countdown timer is not reloaded and keeps its phase. Farther expiries than the
+ *               countdown timer can reach, 255 minutes, are reached in several loads.
+ *  @param[in]   pWheel  			Pointer to the wheel.
+ *  @constraints Call from task context once per countdown timer event, see PCF85063AT_Wheel_OnEvent().
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Wheel_Process() returns the status.
+ */
+int32_t PCF85063AT_Wheel_Process(PCF85063AT_timerwheel_t *pWheel);
+
+/*! @brief       Event handler calling PCF85063AT_Wheel_Process().
+ *  @details     Register it for PCF85063AT_EVENT_TIMER with the wheel as user data. The status is kept in lastStatus.
+ *  @param[in]   event  			Event dispatched.
+ *  @param[in]   pUserData  		Pointer to the wheel.
+ *  @constraints None
+ *  @reentrant   No
+ */
+void PCF85063AT_Wheel_OnEvent(PCF85063AT_EVENT event, void *pUserData);
+
+#endif /* PCF85063AT_WHEEL_H_ */
@@ -14,19 +14,32 @@
 */
 
 #include "issdk_hal.h"
+#include "systick_utils.h"
 
 // SysTick register definitions based on CMSIS definitions.
 #define SYST_CSR SysTick->CTRL // SysTick Control & Status Register
 #define SYST_RVR SysTick->LOAD // SysTick Reload Value Register
 #define SYST_CVR SysTick->VAL  // SysTick Current Value Register
 
-uint32_t g_ovf_stamp;
+// Systicks of a full period, the reload value of the 24 bit counter plus one.
+#define SYST_PERIOD 0x01000000u
+
 volatile uint32_t g_ovf_counter = 0;
+// Count at the start of the current period, and its length: a full one but after BOARD_SystickSetWakeup().
+static volatile uint64_t g_tickBase  = 0;
+static volatile uint32_t g_tickPeriod = SYST_PERIOD;
 
 #ifndef SDK_OS_FREE_RTOS
 // SDK specific SysTick Interrupt Handler
 void SysTick_Handler(void)
 {
+    // A period shortened by BOARD_SystickSetWakeup() also ends a WFE, which takes no interrupt as an event.
+    if (g_tickPeriod != SYST_PERIOD)
+    {
+        __SEV();
+    }
+    g_tickBase += g_tickPeriod;
+    g_tickPeriod = SYST_PERIOD;
     g_ovf_counter += 1;
 }
 #endif
@@ -36,28 +49,102 @@ void BOARD_SystickEnable(void)
 {
     SYST_CSR = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk |
                SysTick_CTRL_ENABLE_Msk; // Enable systick from internal clock with Interrupts.
-    SYST_RVR = 0x00FFFFFFu;             // Set reload to maximum 24 bit value.
+    SYST_RVR = SYST_PERIOD - 1u;        // Set reload to maximum 24 bit value.
     return;
 }
 
 // ARM-core specific function to store the current systick timer ticks.
 void BOARD_SystickStart(int32_t *pStart)
 {
-    // Store the 24 bit systick timer.
-    g_ovf_stamp = g_ovf_counter;
-    *pStart = SYST_CVR & 0x00FFFFFF;
+    *pStart = (int32_t)BOARD_SystickGetTicks();
 }
 
 // ARM-core specific function to compute the elapsed systick timer ticks.
 int32_t BOARD_SystickElapsedTicks(int32_t *pStart)
 {
-    int32_t elapsed;
+    return (int32_t)(BOARD_SystickGetTicks() - (uint32_t)*pStart);
+}
+
+// ARM-core specific function to get the 64 bit free running systick count.
+uint64_t BOARD_SystickGetTicks64(void)
+{
+    uint32_t seq, period, ticks;
+    uint64_t base;
+
+    // Re-read if the overflow interrupt ran between the reads.
+    do
+    {
+        seq    = g_ovf_counter;
+        base   = g_tickBase;
+        period = g_tickPeriod;
+        ticks  = SYST_CVR & 0x00FFFFFF;
+        // A wrap not yet counted, e.g. read with interrupts masked or from an interrupt of the same priority as
+        // SysTick. The counter is 0 from the wrap to the reload a clock later, the period has ended once it
+        // reads anything else.
+        if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) && ((ticks = SYST_CVR & 0x00FFFFFF) != 0u))
+        {
+            base  += period;
+            period = SYST_PERIOD;
+        }
+    } while (seq != g_ovf_counter);
+
+    return base + (period - 1u - ticks);
+}
+
+// ARM-core specific function to get the free running systick count.
+uint32_t BOARD_SystickGetTicks(void)
+{
+    return (uint32_t)BOARD_SystickGetTicks64();
+}
+
+// ARM-core specific function to get the systicks to the next wrap, the interrupt is raised when the counter reaches 0.
+uint32_t BOARD_SystickGetTicksToWrap(void)
+{
+    uint32_t ticks = SYST_CVR & 0x00FFFFFF;
+
+    // At 0 the interrupt of this wrap is already raised, the next one is a whole period away.
+    return ticks ? ticks : SYST_PERIOD;
+}
 
-    // Subtract the stored start ticks and check for wraparound down through zero.
-    elapsed = *pStart - (SYST_CVR & 0x00FFFFFF);
-    elapsed += SYST_RVR * (g_ovf_counter - g_ovf_stamp);
+// ARM-core specific function to raise the SysTick interrupt within ticks, the count stays continuous.
+bool BOARD_SystickSetWakeup(uint32_t ticks)
+{
+#ifndef SDK_OS_FREE_RTOS
+    uint32_t primask, current;
 
-    return elapsed;
+    if ((ticks < 2u) || (ticks > SYST_PERIOD))
+    {
+        return false;
+    }
+
+    primask = DisableGlobalIRQ();
+    current = SYST_CVR & 0x00FFFFFF;
+    // The wrap comes first, or has come and its interrupt is pending.
+    if ((current == 0u) || (current <= ticks) || (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk))
+    {
+        EnableGlobalIRQ(primask);
+        return true;
+    }
+
+    // Writing the counter clears it without an interrupt, it reloads on the next clock. The period under way
+    // ends there, the short one starts: the clocks between the read and the write are not counted.
+    SYST_RVR = ticks - 1u;
+    SYST_CVR = 0u;
+    g_tickBase += g_tickPeriod - current;
+    g_tickPeriod = ticks;
+    // Full periods again from the next reload on.
+    while ((SYST_CVR & 0x00FFFFFF) == 0u)
+    {
+    }
+    SYST_RVR = SYST_PERIOD - 1u;
+    EnableGlobalIRQ(primask);
+
+    return true;
+#else
+    // The RTOS owns the SysTick.
+    (void)ticks;
+    return false;
+#endif
 }
 
 // ARM-core specific function to compute the elapsed time in micro seconds.
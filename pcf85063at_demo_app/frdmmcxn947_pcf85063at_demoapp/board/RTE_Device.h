@@ -21,8 +21,10 @@ extern void LPUART4_DeinitPins();
 /* User needs to provide the implementation of LPI2CX_GetFreq/LPI2CX_InitPins/LPI2CX_DeinitPins for the enabled LPI2C
  * instance. */
 #define RTE_I2C2        1
-// RTE_I2C2_DMA_EN - 1 for EDMA Mode, 0 - for Interrupt Mode
+// RTE_I2C2_DMA_EN - 1 for EDMA Mode, 0 - for Interrupt Mode, may be set by the project.
+#ifndef RTE_I2C2_DMA_EN
 #define RTE_I2C2_DMA_EN 0
+#endif
 
 
 /* User needs to provide the implementation of LPSPIX_GetFreq/LPSPIX_InitPins/LPSPIX_DeinitPins for the enabled LPSPI
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bus_io_i2c.h
+ * @brief The bus_io_i2c.h file declares the per-bus transaction queue used to share
+ *  an I2C instance between several sensors without blocking the callers.
+ */
+
+#ifndef __BUS_IO_I2C_H__
+#define __BUS_IO_I2C_H__
+
+#include "register_io_i2c.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief The number of I2C instances the bus manager can schedule. */
+#ifndef BUS_I2C_MAX_INSTANCES
+#define BUS_I2C_MAX_INSTANCES 8
+#endif
+
+/*! @brief Transaction priorities, lower values are scheduled first. */
+typedef enum
+{
+    BUS_I2C_PRIORITY_HIGH = 0,
+    BUS_I2C_PRIORITY_NORMAL = 1,
+    BUS_I2C_PRIORITY_LOW = 2,
+} busPriority_t;
+
+/*! @brief The kind of a queued transaction. */
+typedef enum
+{
+    BUS_I2C_READ = 0,  /* Write the register address, then read length bytes. */
+    BUS_I2C_WRITE = 1, /* Write the register address followed by length bytes. */
+} busTransactionType_t;
+
+/*!
+ * @brief A queued register transaction.
+ * @details Owned by the caller and must stay valid until its callback has run.
+ *          Only the fields before pNext are set by the caller, Bus_I2C_Submit() fills the rest.
+ */
+typedef struct busTransaction
+{
+    ARM_DRIVER_I2C *pCommDrv;         /* The I2C driver to use. */
+    registerDeviceInfo_t *devInfo;    /* The I2C device number, selects the queue. */
+    uint16_t slaveAddress;            /* The sensor's I2C slave address. */
+    uint8_t type;                     /* busTransactionType_t. */
+    uint8_t priority;                 /* busPriority_t. */
+    uint8_t offset;                   /* The register/offset to access. */
+    uint8_t length;                   /* The number of bytes to read or write. */
+    uint8_t *pBuffer;                 /* Bytes read, or bytes to write (copied when the transaction starts). */
+    registerasynccallback_t callback; /* Completion callback, called from the I2C interrupt context. */
+    void *pUserData;                  /* The parameter passed to the callback. */
+
+    struct busTransaction *pNext;     /* Next queued transaction. */
+    uint32_t submitTick;              /* Systick count when the transaction was queued. */
+    registerAsyncTransfer_t xfer;     /* Register I/O descriptor of the transaction. */
+} busTransaction_t;
+
+/*! @brief The statistics of one bus, wait times are in systicks. */
+typedef struct
+{
+    uint32_t submitted;     /* Transactions accepted by Bus_I2C_Submit(). */
+    uint32_t completed;     /* Transactions completed successfully. */
+    uint32_t failed;        /* Transactions completed with an error. */
+    uint32_t timeouts;      /* Failed transactions which were past their deadline, the bus was recovered. */
+    uint16_t queueDepth;    /* Transactions waiting, the one on the wire excluded. */
+    uint16_t maxQueueDepth; /* High-water mark of queueDepth. */
+    uint32_t totalWaitTicks; /* Sum of the time from submit to start on the wire. */
+    uint32_t maxWaitTicks;  /* Longest time from submit to start on the wire. */
+} busStats_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*!
+ * @brief Queues a register transaction on its bus.
+ * @details The transaction is inserted behind every queued transaction of the same or a higher
+ *          priority and starts at once when the bus is idle. Queued transactions run back to back
+ *          from the completion interrupt of the previous one. While a blocking Register_I2C_* call
+ *          owns the bus they stay queued, and start when it returns. A blocking call made meanwhile
+ *          waits for the transaction on the wire only, then goes ahead of the queued ones.
+ *
+ * @param busTransaction_t *pTransaction - The transaction to queue.
+ *
+ * @return ARM_DRIVER_OK if queued, ARM_DRIVER_ERROR_PARAMETER if the transaction is invalid.
+ */
+int32_t Bus_I2C_Submit(busTransaction_t *pTransaction);
+
+/*!
+ * @brief Enforces the deadline of the transaction on the wire.
+ * @details A transaction which has run longer than the timeout of its device is completed with
+ *          ARM_DRIVER_ERROR_TIMEOUT after Register_I2C_Recover(), and the queue moves on. Called by
+ *          Bus_I2C_Submit() and Bus_I2C_IsBusy(), and to be called periodically while transactions
+ *          are queued, e.g. from the main loop or a timer.
+ *
+ * @param uint8_t deviceInstance - The I2C device number.
+ *
+ * @return ARM_DRIVER_OK, ARM_DRIVER_ERROR_TIMEOUT if the bus was recovered, or ARM_DRIVER_ERROR_PARAMETER.
+ */
+int32_t Bus_I2C_Poll(uint8_t deviceInstance);
+
+/*!
+ * @brief Tells whether a bus has transactions queued or in flight.
+ *
+ * @param uint8_t deviceInstance - The I2C device number.
+ *
+ * @return true while the bus is busy.
+ */
+bool Bus_I2C_IsBusy(uint8_t deviceInstance);
+
+/*!
+ * @brief Gets the statistics of a bus.
+ *
+ * @param uint8_t deviceInstance - The I2C device number.
+ * @param busStats_t *pStats - The statistics snapshot.
+ *
+ * @return ARM_DRIVER_OK or ARM_DRIVER_ERROR_PARAMETER.
+ */
+int32_t Bus_I2C_GetStats(uint8_t deviceInstance, busStats_t *pStats);
+
+/*!
+ * @brief Clears the statistics of a bus, the current queue depth is kept.
+ *
+ * @param uint8_t deviceInstance - The I2C device number.
+ */
+void Bus_I2C_ResetStats(uint8_t deviceInstance);
+
+#endif // __BUS_IO_I2C_H__
@@ -16,6 +16,180 @@
 
 #include "sensor_drv.h"
 #include "Driver_I2C.h"
+#include "Driver_GPIO.h"
+
+/*! @brief The size of the transmit buffer of an asynchronous transfer, register address included. */
+#define REGISTER_ASYNC_BUFFER_SIZE 16
+
+/*! @brief The states of an asynchronous register transfer. */
+typedef enum
+{
+    REGISTER_ASYNC_IDLE = 0, /* No transfer in flight, the descriptor can be reused. */
+    REGISTER_ASYNC_ADDRESS,  /* Register address is on the wire, the data phase follows. */
+    REGISTER_ASYNC_DATA,     /* Last phase is on the wire, the callback follows. */
+} registerAsyncState_t;
+
+/*!
+ * @brief The completion callback of an asynchronous transfer.
+ * @details Called from the I2C interrupt context with ARM_DRIVER_OK, a REGISTER_ERROR class or an ARM_DRIVER
+ *          error code. Asynchronous transfers are not retried.
+ *          The bus is already released, so the callback can start the next transfer.
+ */
+typedef void (*registerasynccallback_t)(void *pUserData, int32_t status);
+
+/*!
+ * @brief The descriptor of an asynchronous transfer.
+ * @details Owned by the caller and must stay valid until the callback has run.
+ */
+typedef struct
+{
+    ARM_DRIVER_I2C *pCommDrv;
+    uint16_t slaveAddress;
+    volatile uint8_t state;
+    uint8_t length;
+    volatile int32_t status; /* Status of the transfer, valid once state is back to REGISTER_ASYNC_IDLE. */
+    uint8_t *pBuffer;
+    registerasynccallback_t callback;
+    void *pUserData;
+    uint32_t startTick; /* SysTick count when the transfer started, see Register_I2C_CheckDeadline(). */
+#if REGISTER_IO_STATS
+    registerDeviceInfo_t *devInfo;
+#endif
+    uint8_t buffer[REGISTER_ASYNC_BUFFER_SIZE];
+} registerAsyncTransfer_t;
+
+/*!
+ * @brief The descriptor of a combined register transfer, see Register_I2C_Transfer().
+ * @details A write phase, register address first, then when readLength is not 0 a read phase after a
+ *          repeated start. The read phase is started from the Signal Event Handler, so the caller waits once.
+ */
+typedef struct
+{
+    const uint8_t *pWriteBuffer; /* The bytes of the write phase, register address first. */
+    uint8_t writeLength;         /* The bytes of the write phase, 1 to REGISTER_ASYNC_BUFFER_SIZE. */
+    uint8_t *pReadBuffer;        /* The buffer of the read phase. */
+    uint8_t readLength;          /* The bytes of the read phase, 0 for a write only transfer. */
+} registerTransfer_t;
+
+/*! @brief The errors of a failed transfer, classified from its events. */
+#define REGISTER_ERROR_ADDRESS_NACK (ARM_DRIVER_ERROR_SPECIFIC - 0)     /* The device did not acknowledge its address. */
+#define REGISTER_ERROR_DATA_NACK (ARM_DRIVER_ERROR_SPECIFIC - 1)        /* The device did not acknowledge a data byte. */
+#define REGISTER_ERROR_ARBITRATION_LOST (ARM_DRIVER_ERROR_SPECIFIC - 2) /* Another master took the bus. */
+#define REGISTER_ERROR_BUS_ERROR (ARM_DRIVER_ERROR_SPECIFIC - 3)        /* A START or STOP out of place. */
+#define REGISTER_ERROR_INCOMPLETE (ARM_DRIVER_ERROR_SPECIFIC - 4)       /* Ended early for another reason, e.g. a
+                                                                           NACK the driver does not tell apart. */
+
+/*! @brief The classes of the errors retried by the blocking functions, see registerRetryPolicy_t. */
+typedef enum
+{
+    REGISTER_ERROR_CLASS_ADDRESS_NACK = 0, /* REGISTER_ERROR_ADDRESS_NACK. */
+    REGISTER_ERROR_CLASS_DATA_NACK,        /* REGISTER_ERROR_DATA_NACK. */
+    REGISTER_ERROR_CLASS_ARBITRATION_LOST, /* REGISTER_ERROR_ARBITRATION_LOST. */
+    REGISTER_ERROR_CLASS_BUS_ERROR,        /* REGISTER_ERROR_BUS_ERROR. */
+    REGISTER_ERROR_CLASS_INCOMPLETE,       /* REGISTER_ERROR_INCOMPLETE. */
+    REGISTER_ERROR_CLASS_TIMEOUT,          /* ARM_DRIVER_ERROR_TIMEOUT, after the bus recovery. */
+    REGISTER_ERROR_CLASS_COUNT,
+} registerErrorClass_t;
+
+/*!
+ * @brief The retry policy of an error class.
+ * @details A blocking function failing with an error of the class waits backoffUs and starts again, up to
+ *          maxRetries times, doubling the wait each time up to maxBackoffUs. A read-modify-write starts again
+ *          from its read.
+ */
+typedef struct
+{
+    uint8_t maxRetries;    /* The retries after the first attempt, 0 to fail at once. */
+    uint16_t backoffUs;    /* The wait before the first retry, in microseconds. */
+    uint16_t maxBackoffUs; /* The longest wait before a retry, in microseconds. */
+} registerRetryPolicy_t;
+
+/*!
+ * @brief The retry policies of a bus until Register_I2C_SetRetryPolicy(), indexed by registerErrorClass_t.
+ * @details A glitch costs at most 100 + 200 us of backoff. A timeout is not retried, its wait bounds the call.
+ */
+#define REGISTER_RETRY_POLICY_DEFAULT                                                        \
+    {                                                                                        \
+        {2, 100, 400}, {2, 100, 400}, {3, 50, 400}, {2, 100, 400}, {2, 100, 400}, {0, 0, 0}, \
+    }
+
+/*! @brief The data bytes from which a DMA transfer pays off, shorter transfers are left to the interrupt driver. */
+#define REGISTER_DMA_MIN_BYTES 4
+
+/*!
+ * @brief The transports of an I2C instance, see Register_I2C_SetTransport().
+ * @details pDmaDrv drives the same bus as the driver passed to the register functions and is initialized with
+ *          the same Signal Event Handler. Transfers of at least dmaMinBytes data bytes go through pDmaDrv,
+ *          both phases of a register read through the same driver.
+ */
+typedef struct
+{
+    ARM_DRIVER_I2C *pDmaDrv; /* The driver moving the bytes by DMA, NULL for none. */
+    uint8_t dmaMinBytes;     /* The data bytes from which a transfer goes through pDmaDrv. */
+} registerTransport_t;
+
+/*! @brief The longest wait for one transfer of a device whose timeoutUs is 0, in microseconds. */
+#ifndef REGISTER_IO_TIMEOUT_US
+#define REGISTER_IO_TIMEOUT_US 10000
+#endif
+
+/*! @brief The SCL pulses of a bus recovery, enough for a device to shift out the rest of a byte and its ACK. */
+#define REGISTER_RECOVERY_CLOCKS 9
+
+/*! @brief The half period of the recovery SCL pulses when halfPeriodUs is 0, 100 kHz. */
+#define REGISTER_RECOVERY_HALF_PERIOD_US 5
+
+/*!
+ * @brief Routes the SCL and SDA pins of a bus.
+ * @details With gpio true, to the GPIO, both pins open drain outputs released high. With gpio false, back to
+ *          the I2C peripheral.
+ */
+typedef void (*registerpinmuxfunction_t)(void *pParam, bool gpio);
+
+/*!
+ * @brief The bus recovery of an I2C instance, see Register_I2C_SetRecovery().
+ * @details A device holding SDA low is clocked by SCL pulses on the GPIO until it releases SDA, then a STOP
+ *          ends its transfer. The I2C driver is then powered down and up again, which restores its default
+ *          bus speed, so busSpeed is set again.
+ */
+typedef struct
+{
+    GENERIC_DRIVER_GPIO *pGpioDrv;      /* The GPIO driver of the pins, NULL to try ARM_I2C_BUS_CLEAR instead. */
+    pinID_t sclPin;                     /* The SCL pin. */
+    pinID_t sdaPin;                     /* The SDA pin. */
+    registerpinmuxfunction_t setPinMux; /* Routes the pins, may be NULL when they stay GPIO capable. */
+    void *pMuxParam;                    /* The parameter passed to setPinMux. */
+    uint8_t halfPeriodUs;               /* The half period of the SCL pulses, 0 for REGISTER_RECOVERY_HALF_PERIOD_US. */
+    uint32_t busSpeed;                  /* The ARM_I2C_BUS_SPEED_x of the bus, 0 to skip the re-initialization. */
+} registerBusRecovery_t;
+
+/*!
+ * @brief Called when a transfer releases the bus, see Register_I2C_SetBusFree().
+ * @details Called from the I2C interrupt context at the end of an asynchronous transfer, after its callback,
+ *          and from the caller's context at the end of a blocking call.
+ */
+typedef void (*registerbusfreefunction_t)(void *pParam);
+
+/*!
+ * @brief The I/O context of an I2C instance, see Register_I2C_Initialize().
+ * @details Holds the state of the bus: the completion and the error of the blocking transfer on it, the
+ *          asynchronous transfer in flight and the settings of the bus. Owned by the caller, so that each stack
+ *          keeps its own and can place it in the RAM bank of its choice, e.g. SRAMX. An instance not bound to
+ *          a context uses a built-in one. The counters stay with each device, see registerIoStats_t.
+ */
+typedef struct
+{
+    volatile bool completionFlag;                     /* Set at the end of a blocking transfer. */
+    volatile uint32_t errorEvent;                     /* The events of a failed blocking transfer. */
+    registerAsyncTransfer_t *volatile pAsyncTransfer; /* The asynchronous transfer in flight, NULL if none. */
+    registerTransport_t transport;                    /* See Register_I2C_SetTransport(). */
+    registerBusRecovery_t recovery;                   /* See Register_I2C_SetRecovery(). */
+    registerRetryPolicy_t retryPolicy[REGISTER_ERROR_CLASS_COUNT]; /* See Register_I2C_SetRetryPolicy(). */
+    bool retryPolicySet;                              /* Use retryPolicy, not REGISTER_RETRY_POLICY_DEFAULT. */
+    volatile bool blocking;                           /* A blocking call owns the bus or waits for it. */
+    registerbusfreefunction_t busFree;                /* See Register_I2C_SetBusFree(). */
+    void *pBusFreeParam;                              /* The parameter passed to busFree. */
+} registerIoContext_t;
 
 #if defined(I2C0)
 /*! @brief The I2C0 device index. */
@@ -147,6 +321,7 @@ void I2C11_SignalEvent_t(uint32_t event);
 
 /*!
  * @brief The interface function to write a sensor register.
+ * @details Owns the bus like Register_I2C_Transfer().
  *
  * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver to use.
  * @param registerDeviceInfo_t *devInfo - The I2C device number and idle function.
@@ -155,7 +330,9 @@ void I2C11_SignalEvent_t(uint32_t event);
  * @param uint8_t *pBuffer - The buffer containing bytes to write.
  * @param uint8_t bytesToWrite - A number of bytes to write.
  *
- * @return ARM_DRIVER_OK if success or ARM_DRIVER_ERROR if error.
+ * @return ARM_DRIVER_OK if success, ARM_DRIVER_ERROR_BUSY if another blocking call owns the bus,
+ *         else the error of the last attempt once the retry policy gives up:
+ *         a REGISTER_ERROR class, ARM_DRIVER_ERROR_TIMEOUT if the bus had to be recovered or ARM_DRIVER_ERROR.
  */
 int32_t Register_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
                                 registerDeviceInfo_t *devInfo,
@@ -177,7 +354,12 @@ int32_t Register_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
  *                       where only the bits set in the mask will be updated according to the value param.
  * @param bool repeatedStart - Indicates whether to send STOP or REPEATED_START bit after the write
  *
- * @return ARM_DRIVER_OK if success or ARM_DRIVER_ERROR if error.
+ * A read-modify-write is retried as a unit, from its read. Owns the bus like Register_I2C_Transfer(), so
+ * that no queued transfer runs between the read and the write.
+ *
+ * @return ARM_DRIVER_OK if success, ARM_DRIVER_ERROR_BUSY if another blocking call owns the bus,
+ *         else the error of the last attempt once the retry policy gives up:
+ *         a REGISTER_ERROR class, ARM_DRIVER_ERROR_TIMEOUT if the bus had to be recovered or ARM_DRIVER_ERROR.
  */
 int32_t Register_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
                            registerDeviceInfo_t *devInfo,
@@ -189,6 +371,7 @@ int32_t Register_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
 
 /*!
  * @brief The interface function to read a sensor register.
+ * @details Runs as one combined transfer, see Register_I2C_Transfer().
  *
  * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver to use.
  * @param registerDeviceInfo_t *devInfo - The I2C device number and idle function.
@@ -197,7 +380,9 @@ int32_t Register_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
  * @param uint8_t length - The number of bytes to read
  * @param uint8_t *pOutBuffer - The pointer to the buffer to store the register value read.
  *
- * @return ARM_DRIVER_OK if success or ARM_DRIVER_ERROR if error.
+ * @return ARM_DRIVER_OK if success, ARM_DRIVER_ERROR_BUSY if another blocking call owns the bus,
+ *         else the error of the last attempt once the retry policy gives up:
+ *         a REGISTER_ERROR class, ARM_DRIVER_ERROR_TIMEOUT if the bus had to be recovered or ARM_DRIVER_ERROR.
  */
 int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
                           registerDeviceInfo_t *devInfo,
@@ -206,4 +391,228 @@ int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
                           uint8_t length,
                           uint8_t *pOutBuffer);
 
+/*!
+ * @brief The interface function to run a combined register transfer.
+ * @details The write phase and the read phase are queued together: the read phase is started with a repeated
+ *          start from the Signal Event Handler and the caller waits once, for the end of the read phase.
+ *          The call owns the bus from start to end, retries included: it first waits for the asynchronous
+ *          transfer in flight, recovering the bus once that has run for the timeout of devInfo, and no
+ *          asynchronous transfer starts until it returns. Not to be called from an interrupt handler which
+ *          the I2C interrupt cannot preempt.
+ *
+ * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver to use.
+ * @param registerDeviceInfo_t *devInfo - The I2C device number and idle function.
+ * @param uint16_t slaveAddress - the sensor's I2C slave address.
+ * @param registerTransfer_t *pTransfer - The transfer, the write bytes are copied before it starts.
+ *
+ * @return ARM_DRIVER_OK if success, ARM_DRIVER_ERROR_BUSY if another blocking call owns the bus,
+ *         ARM_DRIVER_ERROR_PARAMETER, else the error of the last attempt once the retry policy gives up:
+ *         a REGISTER_ERROR class, ARM_DRIVER_ERROR_TIMEOUT if the bus had to be recovered or ARM_DRIVER_ERROR.
+ */
+int32_t Register_I2C_Transfer(ARM_DRIVER_I2C *pCommDrv,
+                              registerDeviceInfo_t *devInfo,
+                              uint16_t slaveAddress,
+                              const registerTransfer_t *pTransfer);
+
+/*!
+ * @brief The interface function to run a combined register transfer without blocking.
+ *
+ * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver to use.
+ * @param registerDeviceInfo_t *devInfo - The I2C device number and idle function.
+ * @param uint16_t slaveAddress - the sensor's I2C slave address.
+ * @param registerTransfer_t *pTransfer - The transfer, the write bytes are copied before the call returns,
+ *                                        the read buffer is valid when the callback runs.
+ * @param registerAsyncTransfer_t *pXfer - The transfer descriptor, owned by the caller until the callback runs.
+ * @param registerasynccallback_t callback - The completion callback, may be NULL.
+ * @param void *pUserData - The parameter passed to the callback.
+ *
+ * @return ARM_DRIVER_OK if the transfer was started, ARM_DRIVER_ERROR_BUSY if the bus is owned by another
+ *         transfer, ARM_DRIVER_ERROR_PARAMETER or ARM_DRIVER_ERROR if error.
+ */
+int32_t Register_I2C_TransferAsync(ARM_DRIVER_I2C *pCommDrv,
+                                   registerDeviceInfo_t *devInfo,
+                                   uint16_t slaveAddress,
+                                   const registerTransfer_t *pTransfer,
+                                   registerAsyncTransfer_t *pXfer,
+                                   registerasynccallback_t callback,
+                                   void *pUserData);
+
+/*!
+ * @brief The interface function to read sensor registers without blocking.
+ *
+ * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver to use.
+ * @param registerDeviceInfo_t *devInfo - The I2C device number and idle function.
+ * @param uint16_t slaveAddress - the sensor's I2C slave address.
+ * @param uint8_t offset - The register/offset to read from
+ * @param uint8_t length - The number of bytes to read
+ * @param uint8_t *pOutBuffer - The buffer to store the registers read, valid when the callback runs.
+ * @param registerAsyncTransfer_t *pXfer - The transfer descriptor, owned by the caller until the callback runs.
+ * @param registerasynccallback_t callback - The completion callback, may be NULL.
+ * @param void *pUserData - The parameter passed to the callback.
+ *
+ * @return ARM_DRIVER_OK if the transfer was started, ARM_DRIVER_ERROR_BUSY if the bus is owned by another
+ *         transfer or ARM_DRIVER_ERROR if error.
+ */
+int32_t Register_I2C_ReadAsync(ARM_DRIVER_I2C *pCommDrv,
+                               registerDeviceInfo_t *devInfo,
+                               uint16_t slaveAddress,
+                               uint8_t offset,
+                               uint8_t length,
+                               uint8_t *pOutBuffer,
+                               registerAsyncTransfer_t *pXfer,
+                               registerasynccallback_t callback,
+                               void *pUserData);
+
+/*!
+ * @brief The interface function to block write sensor registers without blocking.
+ *
+ * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver to use.
+ * @param registerDeviceInfo_t *devInfo - The I2C device number and idle function.
+ * @param uint16_t slaveAddress - the sensor's I2C slave address.
+ * @param uint8_t offset - The register/offset to write to.
+ * @param uint8_t *pBuffer - The bytes to write, copied before the call returns.
+ * @param uint8_t bytesToWrite - A number of bytes to write, less than REGISTER_ASYNC_BUFFER_SIZE.
+ * @param registerAsyncTransfer_t *pXfer - The transfer descriptor, owned by the caller until the callback runs.
+ * @param registerasynccallback_t callback - The completion callback, may be NULL.
+ * @param void *pUserData - The parameter passed to the callback.
+ *
+ * @return ARM_DRIVER_OK if the transfer was started, ARM_DRIVER_ERROR_BUSY if the bus is owned by another
+ *         transfer or ARM_DRIVER_ERROR if error.
+ */
+int32_t Register_I2C_BlockWriteAsync(ARM_DRIVER_I2C *pCommDrv,
+                                     registerDeviceInfo_t *devInfo,
+                                     uint16_t slaveAddress,
+                                     uint8_t offset,
+                                     const uint8_t *pBuffer,
+                                     uint8_t bytesToWrite,
+                                     registerAsyncTransfer_t *pXfer,
+                                     registerasynccallback_t callback,
+                                     void *pUserData);
+
+/*!
+ * @brief Binds an I/O context to an I2C instance and initializes its driver with the Signal Event Handler of
+ *        the instance.
+ * @details Call before any other function on the instance, or while no transfer is in flight on it. The
+ *          context is cleared: no DMA driver, abort only recovery and REGISTER_RETRY_POLICY_DEFAULT until the
+ *          setters below. A DMA driver of the instance is initialized by the caller with I2Cx_SignalEvent_t.
+ *          The SysTick must be running, see BOARD_SystickEnable(): transfer timeouts, retry backoffs and the
+ *          bus recovery are timed on it. Without it a transfer waits for its completion event with no timeout,
+ *          and backoffs and recovery pulses are counted in passes of at least one core cycle, so they are
+ *          shorter than asked.
+ *
+ * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver of the instance.
+ * @param uint8_t deviceInstance - The I2C device number.
+ * @param registerIoContext_t *pContext - The context, owned by the caller for as long as it is bound.
+ *                                        NULL for the built-in context of the instance.
+ *
+ * @return The status of pCommDrv->Initialize(), ARM_DRIVER_ERROR_PARAMETER or ARM_DRIVER_ERROR_BUSY if a
+ *         transfer is in flight.
+ */
+int32_t Register_I2C_Initialize(ARM_DRIVER_I2C *pCommDrv, uint8_t deviceInstance, registerIoContext_t *pContext);
+
+/*!
+ * @brief Sets the transports of an I2C instance.
+ * @details Call while no transfer is in flight on the instance.
+ *
+ * @param uint8_t deviceInstance - The I2C device number.
+ * @param registerTransport_t *pTransport - The transports, copied. NULL to use the driver of each call only.
+ *
+ * @return ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER or ARM_DRIVER_ERROR_BUSY if an asynchronous transfer is in flight.
+ */
+int32_t Register_I2C_SetTransport(uint8_t deviceInstance, const registerTransport_t *pTransport);
+
+/*!
+ * @brief Sets the retry policies of an I2C instance.
+ * @details Call while no transfer is in flight on the instance.
+ *
+ * @param uint8_t deviceInstance - The I2C device number.
+ * @param registerRetryPolicy_t *pPolicies - REGISTER_ERROR_CLASS_COUNT policies indexed by registerErrorClass_t,
+ *                                           copied. NULL for REGISTER_RETRY_POLICY_DEFAULT.
+ *
+ * @return ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER or ARM_DRIVER_ERROR_BUSY if an asynchronous transfer is in flight.
+ */
+int32_t Register_I2C_SetRetryPolicy(uint8_t deviceInstance, const registerRetryPolicy_t *pPolicies);
+
+/*!
+ * @brief Sets the bus recovery of an I2C instance.
+ * @details Call while no transfer is in flight on the instance. Without a recovery, a timeout only aborts the
+ *          transfer.
+ *
+ * @param uint8_t deviceInstance - The I2C device number.
+ * @param registerBusRecovery_t *pRecovery - The recovery, copied. NULL for none.
+ *
+ * @return ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER or ARM_DRIVER_ERROR_BUSY if an asynchronous transfer is in flight.
+ */
+int32_t Register_I2C_SetRecovery(uint8_t deviceInstance, const registerBusRecovery_t *pRecovery);
+
+/*!
+ * @brief Recovers the bus of a device.
+ * @details Aborts the transfer in flight, completing an asynchronous one with ARM_DRIVER_ERROR_TIMEOUT, clocks
+ *          SCL until SDA is released, sends a STOP and re-initializes pCommDrv, see registerBusRecovery_t.
+ *          Called by the blocking functions when a transfer is not complete within the timeout of the device,
+ *          call it when an asynchronous transfer is late.
+ *
+ * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver of the bus.
+ * @param registerDeviceInfo_t *devInfo - The I2C device number and counters.
+ *
+ * @return ARM_DRIVER_OK, or ARM_DRIVER_ERROR if SDA is still held low or the driver fails to restart.
+ */
+int32_t Register_I2C_Recover(ARM_DRIVER_I2C *pCommDrv, registerDeviceInfo_t *devInfo);
+
+/*!
+ * @brief Recovers the bus of a device when the asynchronous transfer in flight on it is late.
+ * @details The transfer is late once it has run for the timeout of devInfo. Call it from a periodic context,
+ *          e.g. the main loop, as long as an asynchronous transfer may be in flight.
+ *
+ * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver of the bus.
+ * @param registerDeviceInfo_t *devInfo - The I2C device number, timeout and counters.
+ *
+ * @return ARM_DRIVER_OK if no transfer is late, ARM_DRIVER_ERROR_TIMEOUT if the bus was recovered,
+ *         ARM_DRIVER_ERROR_PARAMETER.
+ */
+int32_t Register_I2C_CheckDeadline(ARM_DRIVER_I2C *pCommDrv, registerDeviceInfo_t *devInfo);
+
+/*!
+ * @brief Sets the function called each time a transfer releases the bus of an I2C instance.
+ * @details Lets a scheduler start the transfers it holds back while the bus is owned, see registerIoContext_t.
+ *          Cleared by Register_I2C_Initialize().
+ *
+ * @param uint8_t deviceInstance - The I2C device number.
+ * @param registerbusfreefunction_t busFree - The function, NULL for none.
+ * @param void *pParam - The parameter passed to busFree.
+ *
+ * @return ARM_DRIVER_OK or ARM_DRIVER_ERROR_PARAMETER.
+ */
+int32_t Register_I2C_SetBusFree(uint8_t deviceInstance, registerbusfreefunction_t busFree, void *pParam);
+
+/*!
+ * @brief Selects the driver of a register transfer.
+ *
+ * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver of the call.
+ * @param uint8_t deviceInstance - The I2C device number.
+ * @param uint32_t dataBytes - The data bytes of the transfer, register address excluded.
+ *
+ * @return The DMA driver of the instance for a transfer long enough, pCommDrv otherwise.
+ */
+ARM_DRIVER_I2C *Register_I2C_SelectTransport(ARM_DRIVER_I2C *pCommDrv, uint8_t deviceInstance, uint32_t dataBytes);
+
+#if REGISTER_IO_STATS
+/*!
+ * @brief Gets the register I/O counters of a device.
+ *
+ * @param registerDeviceInfo_t *devInfo - The I2C device number and counters.
+ * @param registerIoStats_t *pStats - The counters snapshot.
+ *
+ * @return ARM_DRIVER_OK or ARM_DRIVER_ERROR_PARAMETER.
+ */
+int32_t Register_I2C_GetStats(registerDeviceInfo_t *devInfo, registerIoStats_t *pStats);
+
+/*!
+ * @brief Clears the register I/O counters of a device.
+ *
+ * @param registerDeviceInfo_t *devInfo - The I2C device number and counters.
+ */
+void Register_I2C_ResetStats(registerDeviceInfo_t *devInfo);
+#endif
+
 #endif // __REGISTER_IO_I2C_H__
@@ -35,6 +35,7 @@ enum ESensorErrors
     SENSOR_ERROR_INIT,
     SENSOR_ERROR_WRITE,
     SENSOR_ERROR_READ,
+    SENSOR_ERROR_BUSY,
 };
 
 /* The MAXIMUM number of Sensor Registers possible. */
@@ -95,6 +96,47 @@ typedef struct
  */
 typedef void (*registeridlefunction_t)(void *userParam);
 
+/*!
+ * @brief The ways register I/O waits for a transfer.
+ */
+typedef enum
+{
+    REGISTER_WAIT_YIELD = 0, /* Call the idle function, e.g. the yield of a cooperative scheduler, spin without one.*/
+    REGISTER_WAIT_SPIN,      /* Spin on __NOP().*/
+    REGISTER_WAIT_WFE,       /* Sleep in __WFE(), the Signal Event Handler sends an event. The SysTick interrupt
+                                is armed at the deadline.*/
+    REGISTER_WAIT_WFI,       /* Sleep in __WFI(), interrupts masked from the completion check to the sleep. The
+                                SysTick interrupt is armed at the deadline.*/
+    REGISTER_WAIT_MODE_COUNT,
+} registerWaitMode_t;
+
+/*! @brief Set to 1 to count the register I/O of every device, see registerIoStats_t. */
+#ifndef REGISTER_IO_STATS
+#define REGISTER_IO_STATS 0
+#endif
+
+/*!
+ * @brief This structure defines the register I/O counters of a device.
+ */
+typedef struct
+{
+    uint32_t transactions;      /* Transfers started on the bus.*/
+    uint32_t dmaTransactions;   /* Transfers of them moved by DMA.*/
+    uint32_t bytesWritten;      /* Bytes written, register addresses included.*/
+    uint32_t bytesRead;         /* Bytes read.*/
+    uint32_t nacks;             /* Transfers not acknowledged by the device.*/
+    uint32_t arbitrationLost;   /* Transfers which lost the bus to another master.*/
+    uint32_t incomplete;        /* Transfers which ended before all the bytes were sent or received.*/
+    uint32_t aborts;            /* Transfers aborted by the register I/O.*/
+    uint32_t timeouts;          /* Transfers not complete within the timeout of the device.*/
+    uint32_t recoveries;        /* Bus recoveries run after a timeout.*/
+    uint32_t retries;           /* Operations started again after a transient error, see registerRetryPolicy_t.*/
+    uint32_t waitIterations;    /* Passes of the busy-wait loops.*/
+    uint32_t maxWaitIterations; /* Most passes spent waiting for one transfer.*/
+    uint64_t waitCycles[REGISTER_WAIT_MODE_COUNT]; /* SysTick ticks spent waiting, per registerWaitMode_t actually
+                                                      used: a sleeping mode which cannot sleep counts as spin.*/
+} registerIoStats_t;
+
 /*!
  * @brief This structure defines the device specific info required by register I/O.
  */
@@ -103,6 +145,11 @@ typedef struct
     registeridlefunction_t idleFunction;
     void *functionParam;
     uint8_t deviceInstance;
+    uint32_t timeoutUs; /* Longest wait for one transfer in microseconds, 0 for REGISTER_IO_TIMEOUT_US. */
+    uint8_t waitMode;   /* How to wait for a transfer, see registerWaitMode_t. */
+#if REGISTER_IO_STATS
+    registerIoStats_t stats; /* Register I/O counters, see Register_I2C_GetStats(). */
+#endif
 } registerDeviceInfo_t;
 
 #endif //_SENSOR_DRV_H
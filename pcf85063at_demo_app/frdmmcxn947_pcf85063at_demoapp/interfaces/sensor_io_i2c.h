@@ -19,6 +19,14 @@
 #include "Driver_I2C.h"
 #include "register_io_i2c.h"
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief The number of write list entries sorted and merged together by Sensor_I2C_Write(). */
+#ifndef SENSOR_I2C_WRITE_BATCH
+#define SENSOR_I2C_WRITE_BATCH 16
+#endif
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -39,6 +47,10 @@ int32_t Sensor_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
                               uint8_t error_mask);
 
 /*! @brief       Write register data to a sensor
+ *  @details     Entries are sorted by register and entries for the same register are merged, in batches of
+ *               SENSOR_I2C_WRITE_BATCH. Each run of adjacent registers is then written with one block write,
+ *               preceded by one block read only when an entry of the run is masked.
+ *               Lists that depend on the order of writes to different registers must be split.
 
  *  @param[in]   pCommDrv      pointer to the I2C ARM driver to use
  *  @param[in]   devInfo       The I2C device number and idle function.
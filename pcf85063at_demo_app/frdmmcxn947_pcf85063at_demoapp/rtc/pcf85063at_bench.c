@@ -0,0 +1,571 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * pcf85063at_bench.c
+ *
+ * @file pcf85063at_bench.c
+ * @brief The pcf85063at_bench.c file implements the micro benchmark of the PCF85063AT driver APIs.
+ */
+
+#include <string.h>
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+
+#include "issdk_hal.h"
+#include "pcf85063at_bench.h"
+#include "pcf85063at_alarms.h"
+#include "systick_utils.h"
+#include "fsl_debug_console.h"
+
+//-----------------------------------------------------------------------
+// Types
+//-----------------------------------------------------------------------
+
+/*! @brief An API call under measurement.*/
+typedef struct
+{
+	const char *name;
+	int32_t (*pFunction)(PCF85063AT_sensorhandle_t *pSensorHandle);
+} PCF85063AT_benchcase_t;
+
+//-----------------------------------------------------------------------
+// Global Variables
+//-----------------------------------------------------------------------
+
+static ARM_DRIVER_I2C *s_pBenchBus;
+static uint32_t s_benchTransactions;
+static uint32_t s_benchBytes;
+static uint32_t s_benchWaitCycles;
+static uint32_t s_benchLastTick;
+static volatile bool s_benchAsyncDone;
+static PCF85063AT_alarmscheduler_t s_benchScheduler;
+static uint32_t s_benchAlarmEpoch;
+
+static const registerreadlist_t s_benchTimeList[] = {
+		{.readFrom = PCF85063AT_SECOND, .numBytes = PCF85063AT_TIME_SIZE_BYTE}, __END_READ_DATA__};
+static const registerreadlist_t s_benchAlarmList[] = {
+		{.readFrom = PCF85063AT_SECOND_ALARM, .numBytes = PCF85063AT_ALARM_TIME_SIZE_BYTE}, __END_READ_DATA__};
+static const registerwritelist_t s_benchConfig[] = {
+		{PCF85063AT_CTRL1, 0x00, PCF85063AT_CTRL1_12_HOUR_24_HOUR_MODE_MASK}, __END_WRITE_DATA__}; /* 24h mode */
+
+/*! 2024-02-29 23:59:30 Thursday, 24h.*/
+static const PCF85063AT_timedata_t s_benchTime = {30, 59, 23, 29, 4, 2, 24, h24};
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+
+/* Counting proxy of the bus, the wait of a transfer starts when it is started. */
+static ARM_DRIVER_VERSION PCF85063AT_Bench_GetVersion(void)
+{
+	return s_pBenchBus->GetVersion();
+}
+
+static ARM_I2C_CAPABILITIES PCF85063AT_Bench_GetCapabilities(void)
+{
+	return s_pBenchBus->GetCapabilities();
+}
+
+static int32_t PCF85063AT_Bench_Initialize(ARM_I2C_SignalEvent_t cb_event)
+{
+	return s_pBenchBus->Initialize(cb_event);
+}
+
+static int32_t PCF85063AT_Bench_Uninitialize(void)
+{
+	return s_pBenchBus->Uninitialize();
+}
+
+static int32_t PCF85063AT_Bench_PowerControl(ARM_POWER_STATE state)
+{
+	return s_pBenchBus->PowerControl(state);
+}
+
+static int32_t PCF85063AT_Bench_MasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num, bool xfer_pending)
+{
+	s_benchTransactions++;
+	s_benchBytes += num + 1;
+	s_benchLastTick = BOARD_SystickGetTicks();
+	return s_pBenchBus->MasterTransmit(addr, data, num, xfer_pending);
+}
+
+static int32_t PCF85063AT_Bench_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num, bool xfer_pending)
+{
+	s_benchTransactions++;
+	s_benchBytes += num + 1;
+	s_benchLastTick = BOARD_SystickGetTicks();
+	return s_pBenchBus->MasterReceive(addr, data, num, xfer_pending);
+}
+
+static int32_t PCF85063AT_Bench_SlaveTransmit(const uint8_t *data, uint32_t num)
+{
+	return s_pBenchBus->SlaveTransmit(data, num);
+}
+
+static int32_t PCF85063AT_Bench_SlaveReceive(uint8_t *data, uint32_t num)
+{
+	return s_pBenchBus->SlaveReceive(data, num);
+}
+
+static int32_t PCF85063AT_Bench_GetDataCount(void)
+{
+	return s_pBenchBus->GetDataCount();
+}
+
+static int32_t PCF85063AT_Bench_Control(uint32_t control, uint32_t arg)
+{
+	return s_pBenchBus->Control(control, arg);
+}
+
+static ARM_I2C_STATUS PCF85063AT_Bench_GetStatus(void)
+{
+	return s_pBenchBus->GetStatus();
+}
+
+static ARM_DRIVER_I2C s_benchProxy = {
+	PCF85063AT_Bench_GetVersion, PCF85063AT_Bench_GetCapabilities, PCF85063AT_Bench_Initialize,
+	PCF85063AT_Bench_Uninitialize, PCF85063AT_Bench_PowerControl, PCF85063AT_Bench_MasterTransmit,
+	PCF85063AT_Bench_MasterReceive, PCF85063AT_Bench_SlaveTransmit, PCF85063AT_Bench_SlaveReceive,
+	PCF85063AT_Bench_GetDataCount, PCF85063AT_Bench_Control, PCF85063AT_Bench_GetStatus,
+};
+
+/* Idle task of the wait loops, accumulates the systicks up to the end of each pass. */
+static void PCF85063AT_Bench_Idle(void *pUserData)
+{
+	uint32_t tick;
+
+	(void)pUserData;
+	__NOP();
+	tick = BOARD_SystickGetTicks();
+	s_benchWaitCycles += tick - s_benchLastTick;
+	s_benchLastTick = tick;
+}
+
+static void PCF85063AT_Bench_AsyncDone(void *pUserData, int32_t status)
+{
+	(void)pUserData;
+	(void)status;
+	s_benchAsyncDone = true;
+}
+
+/* Wrappers of the APIs which take more than the handle. */
+static int32_t PCF85063AT_Bench_Configure(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	return PCF85063AT_Configure(pSensorHandle, s_benchConfig);
+}
+
+static int32_t PCF85063AT_Bench_UpdateRegister(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	return PCF85063AT_UpdateRegister(pSensorHandle, PCF85063AT_RAM_BYTE, 0x5A, 0xFF);
+}
+
+static int32_t PCF85063AT_Bench_SetTime(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_timedata_t time = s_benchTime;
+
+	return PCF85063AT_SetTime(pSensorHandle, &time);
+}
+
+static int32_t PCF85063AT_Bench_GetTime(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_timedata_t time;
+
+	return PCF85063AT_GetTime(pSensorHandle, s_benchTimeList, &time);
+}
+
+static int32_t PCF85063AT_Bench_GetTimeCoherent(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_timedata_t time;
+
+	return PCF85063AT_GetTimeCoherent(pSensorHandle, &time, NULL, NULL);
+}
+
+static int32_t PCF85063AT_Bench_Snapshot(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_snapshot_t snapshot;
+
+	return PCF85063AT_Snapshot(pSensorHandle, &snapshot);
+}
+
+static int32_t PCF85063AT_Bench_GetTimeAsync(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_timedata_t time;
+	int32_t status;
+
+	s_benchAsyncDone = false;
+	status = PCF85063AT_GetTimeAsync(pSensorHandle, &time, PCF85063AT_Bench_AsyncDone, NULL);
+	while ((SENSOR_ERROR_NONE == status) && !s_benchAsyncDone)
+	{
+		PCF85063AT_Bench_Idle(NULL);
+	}
+	return status;
+}
+
+static int32_t PCF85063AT_Bench_SetTimeAsync(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	int32_t status;
+
+	s_benchAsyncDone = false;
+	status = PCF85063AT_SetTimeAsync(pSensorHandle, &s_benchTime, PCF85063AT_Bench_AsyncDone, NULL);
+	while ((SENSOR_ERROR_NONE == status) && !s_benchAsyncDone)
+	{
+		PCF85063AT_Bench_Idle(NULL);
+	}
+	return status;
+}
+
+static int32_t PCF85063AT_Bench_TimeToEpoch(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	uint32_t epoch;
+
+	(void)pSensorHandle;
+	return PCF85063AT_TimeToEpoch(&s_benchTime, &epoch);
+}
+
+static int32_t PCF85063AT_Bench_EpochToTime(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_timedata_t time;
+
+	(void)pSensorHandle;
+	return PCF85063AT_EpochToTime(1709251170U, mode24H, &time);
+}
+
+static int32_t PCF85063AT_Bench_GetEpoch(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	uint32_t epoch;
+
+	return PCF85063AT_GetEpoch(pSensorHandle, &epoch);
+}
+
+static int32_t PCF85063AT_Bench_SetEpoch(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	return PCF85063AT_SetEpoch(pSensorHandle, 1709251170U);
+}
+
+static int32_t PCF85063AT_Bench_ModeSet(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	return PCF85063AT_12h_24h_Mode_Set(pSensorHandle, mode24H);
+}
+
+static int32_t PCF85063AT_Bench_ModeGet(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	Mode12h_24h mode;
+
+	return PCF85063AT_12h_24h_Mode_Get(pSensorHandle, &mode);
+}
+
+static int32_t PCF85063AT_Bench_GetCtrl2(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	uint8_t ctrl2;
+
+	return PCF85063AT_Get_Ctrl2(pSensorHandle, &ctrl2);
+}
+
+static int32_t PCF85063AT_Bench_ClearFlags(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	return PCF85063AT_Clear_Flags(pSensorHandle, PCF85063AT_CTRL2_FLAGS_MASK);
+}
+
+static int32_t PCF85063AT_Bench_CheckMinHalfMinCTInt(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	IntState state;
+
+	return PCF85063AT_Check_MinHalfMinCTInt(pSensorHandle, &state);
+}
+
+static int32_t PCF85063AT_Bench_CheckAlarmInt(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	IntState state;
+
+	return PCF85063AT_Check_AlarmInt(pSensorHandle, &state);
+}
+
+static int32_t PCF85063AT_Bench_AlarmIntEnable(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	return PCF85063AT_AlarmInt_Enable(pSensorHandle, A_Minute);
+}
+
+static int32_t PCF85063AT_Bench_GetAlarmTime(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_alarmdata_t alarm;
+
+	return PCF85063AT_GetAlarmTime(pSensorHandle, s_benchAlarmList, &alarm);
+}
+
+static int32_t PCF85063AT_Bench_SetAlarmTime(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_alarmdata_t alarm = {0, 30, 7, 1, 1, h24};
+
+	return PCF85063AT_SetAlarmTime(pSensorHandle, &alarm);
+}
+
+static int32_t PCF85063AT_Bench_SetAlarmFrame(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_alarmdata_t alarm = {0, 30, 7, 1, 1, h24};
+	PCF85063AT_alarmframe_t frame;
+
+	(void)PCF85063AT_AlarmToBcd(&alarm, A_Seconds, &frame);
+	return PCF85063AT_SetAlarmFrame(pSensorHandle, &frame);
+}
+
+static void PCF85063AT_Bench_AlarmDone(uint8_t id, uint32_t epoch, void *pUserData)
+{
+	(void)id;
+	(void)epoch;
+	(void)pUserData;
+}
+
+/* Each call schedules an alarm nearer than the armed one, the measured call is the re-arm of the scheduler. */
+static int32_t PCF85063AT_Bench_AlarmsArm(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	int32_t status;
+
+	if (s_benchScheduler.pSensorHandle == NULL)
+	{
+		(void)PCF85063AT_Alarms_Init(&s_benchScheduler, pSensorHandle);
+		status = PCF85063AT_GetEpoch(pSensorHandle, &s_benchAlarmEpoch);
+		if (SENSOR_ERROR_NONE != status)
+		{
+			return status;
+		}
+		s_benchAlarmEpoch += 3600U;
+	}
+
+	s_benchAlarmEpoch--;
+	return PCF85063AT_Alarms_Insert(&s_benchScheduler, s_benchAlarmEpoch, PCF85063AT_Bench_AlarmDone, NULL, NULL);
+}
+
+static int32_t PCF85063AT_Bench_SetTimerClockFreq(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	return PCF85063AT_SetTimerClockFreq(pSensorHandle, 2);
+}
+
+static int32_t PCF85063AT_Bench_CountdownTimerValue(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	return PCF85063AT_Countdown_timer_value(pSensorHandle, 64);
+}
+
+static int32_t PCF85063AT_Bench_SetOffset(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	return PCF85063AT_Set_offset(pSensorHandle, 0);
+}
+
+static int32_t PCF85063AT_Bench_CountdownStart(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	return PCF85063AT_Countdown_Start(pSensorHandle, timer2, 64);
+}
+
+static int32_t PCF85063AT_Bench_TimerPlan(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_timerplan_t plan;
+
+	(void)pSensorHandle;
+	return PCF85063AT_TimerPlan(1000000U, &plan);
+}
+
+static int32_t PCF85063AT_Bench_TimerPlanApply(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	PCF85063AT_timerplan_t plan;
+
+	(void)PCF85063AT_TimerPlan(1000000U, &plan);
+	return PCF85063AT_TimerPlan_Apply(pSensorHandle, &plan);
+}
+
+static int32_t PCF85063AT_Bench_GetOffset(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	uint8_t offset;
+
+	return PCF85063AT_Get_Offset(pSensorHandle, &offset);
+}
+
+static int32_t PCF85063AT_Bench_CheckTITP(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	TI_TP_State state;
+
+	return PCF85063AT_Check_TI_TP(pSensorHandle, &state);
+}
+
+/*! In call order: stop and test mode are undone by the next case, SwRst closes the run.
+ *  PCF85063AT_Deinit() is declared but has no implementation.*/
+static const PCF85063AT_benchcase_t s_benchCases[] = {
+	{"Configure", PCF85063AT_Bench_Configure},
+	{"UpdateRegister", PCF85063AT_Bench_UpdateRegister},
+	{"Rtc_Stop", PCF85063AT_Rtc_Stop},
+	{"SetTime", PCF85063AT_Bench_SetTime},
+	{"Rtc_Start", PCF85063AT_Rtc_Start},
+	{"GetTime", PCF85063AT_Bench_GetTime},
+	{"GetTimeCoherent", PCF85063AT_Bench_GetTimeCoherent},
+	{"Snapshot", PCF85063AT_Bench_Snapshot},
+	{"GetTimeAsync", PCF85063AT_Bench_GetTimeAsync},
+	{"SetTimeAsync", PCF85063AT_Bench_SetTimeAsync},
+	{"TimeToEpoch", PCF85063AT_Bench_TimeToEpoch},
+	{"EpochToTime", PCF85063AT_Bench_EpochToTime},
+	{"GetEpoch", PCF85063AT_Bench_GetEpoch},
+	{"SetEpoch", PCF85063AT_Bench_SetEpoch},
+	{"12h_24h_Mode_Set", PCF85063AT_Bench_ModeSet},
+	{"12h_24h_Mode_Get", PCF85063AT_Bench_ModeGet},
+	{"Get_Ctrl2", PCF85063AT_Bench_GetCtrl2},
+	{"Clear_Flags", PCF85063AT_Bench_ClearFlags},
+	{"MinInt_Enable", PCF85063AT_MinInt_Enable},
+	{"MinInt_Disable", PCF85063AT_MinInt_Disable},
+	{"HalfMinInt_Enable", PCF85063AT_HalfMinInt_Enable},
+	{"HalfMinInt_Disable", PCF85063AT_HalfMinInt_Disable},
+	{"Check_MinHalfMinCTInt", PCF85063AT_Bench_CheckMinHalfMinCTInt},
+	{"Clear_MinHalfMinCTInt", PCF85063AT_Clear_MinHalfMinCTInt},
+	{"SetAlarmTime", PCF85063AT_Bench_SetAlarmTime},
+	{"SetAlarmFrame", PCF85063AT_Bench_SetAlarmFrame},
+	{"GetAlarmTime", PCF85063AT_Bench_GetAlarmTime},
+	{"Alarms_Arm", PCF85063AT_Bench_AlarmsArm},
+	{"AlarmInt_Enable", PCF85063AT_Bench_AlarmIntEnable},
+	{"AlarmInt_Disable", PCF85063AT_AlarmInt_Disable},
+	{"Check_AlarmInt", PCF85063AT_Bench_CheckAlarmInt},
+	{"Clear_AlarmInt", PCF85063AT_Clear_AlarmInt},
+	{"ExtTestMode", PCF85063AT_ExtTestMode},
+	{"normalMode", PCF85063AT_normalMode},
+	{"capSel_12", PCF85063AT_capSel_12},
+	{"capSel_7", PCF85063AT_capSel_7},
+	{"SetTimerClockFreq", PCF85063AT_Bench_SetTimerClockFreq},
+	{"Countdown_timer_value", PCF85063AT_Bench_CountdownTimerValue},
+	{"TimerInt_Enable", PCF85063AT_TimerInt_Enable},
+	{"TI_TP_Enable", PCF85063AT_TI_TP_Enable},
+	{"Check_TI_TP", PCF85063AT_Bench_CheckTITP},
+	{"TI_TP_Disable", PCF85063AT_TI_TP_Disable},
+	{"timer_enable", PCF85063AT_timer_enable},
+	{"timer_disable", PCF85063AT_timer_disable},
+	{"TimerInt_Disable", PCF85063AT_TimerInt_Disable},
+	{"Countdown_Start", PCF85063AT_Bench_CountdownStart},
+	{"Countdown_Stop", PCF85063AT_Countdown_Stop},
+	{"TimerPlan", PCF85063AT_Bench_TimerPlan},
+	{"TimerPlan_Apply", PCF85063AT_Bench_TimerPlanApply},
+	{"TestFreeRAMByte", PCF85063AT_TestFreeRAMByte},
+	{"Course_OffsetMode", PCF85063AT_Course_OffsetMode},
+	{"Normal_OffsetMode", PCF85063AT_Normal_OffsetMode},
+	{"Set_offset", PCF85063AT_Bench_SetOffset},
+	{"Get_Offset", PCF85063AT_Bench_GetOffset},
+	{"CI_enable", PCF85063AT_CI_enable},
+	{"CI_disable", PCF85063AT_CI_disable},
+	{"SwRst", PCF85063AT_SwRst},
+};
+
+/* Measure one call, the counters cover the proxy traffic of this call only. */
+static void PCF85063AT_Bench_Measure(PCF85063AT_sensorhandle_t *pSensorHandle, const PCF85063AT_benchcase_t *pCase,
+		PCF85063AT_benchresult_t *pResult)
+{
+	int32_t start;
+
+	s_benchTransactions = 0;
+	s_benchBytes = 0;
+	s_benchWaitCycles = 0;
+
+	BOARD_SystickStart(&start);
+	pResult->status = pCase->pFunction(pSensorHandle);
+	pResult->time_us = BOARD_SystickElapsedTime_us(&start);
+
+	pResult->name = pCase->name;
+	pResult->transactions = s_benchTransactions;
+	pResult->bytes = s_benchBytes;
+	pResult->waitCycles = s_benchWaitCycles;
+}
+
+int32_t PCF85063AT_Bench_Run(ARM_DRIVER_I2C *pBus, uint8_t index, uint16_t sAddress,
+		PCF85063AT_benchresult_t *pResults, uint32_t *pCount)
+{
+	PCF85063AT_sensorhandle_t sensorHandle;
+	int32_t status, start;
+	uint32_t i, count = 0;
+
+	/*! Validate for the correct bus and result variables.*/
+	if ((pBus == NULL) || (pResults == NULL) || (pCount == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! The proxy forwards everything to pBus, counting the master transfers on the way. */
+	s_pBenchBus = pBus;
+	s_benchScheduler.pSensorHandle = NULL;
+
+	s_benchTransactions = 0;
+	s_benchBytes = 0;
+	s_benchWaitCycles = 0;
+	BOARD_SystickStart(&start);
+	status = PCF85063AT_Initialize(&sensorHandle, &s_benchProxy, index, sAddress);
+	pResults[count].time_us = BOARD_SystickElapsedTime_us(&start);
+	pResults[count].name = "Initialize";
+	pResults[count].status = status;
+	pResults[count].transactions = s_benchTransactions;
+	pResults[count].bytes = s_benchBytes;
+	pResults[count].waitCycles = s_benchWaitCycles;
+	count++;
+	if (SENSOR_ERROR_NONE != status)
+	{
+		*pCount = count;
+		return status;
+	}
+	PCF85063AT_SetIdleTask(&sensorHandle, PCF85063AT_Bench_Idle, NULL);
+
+	for (i = 0; (i < sizeof(s_benchCases) / sizeof(s_benchCases[0])) && (count < PCF85063AT_BENCH_MAX_CASES); i++)
+	{
+		/*! Warm up the shadow registers, then measure. */
+		s_benchCases[i].pFunction(&sensorHandle);
+		PCF85063AT_Bench_Measure(&sensorHandle, &s_benchCases[i], &pResults[count++]);
+	}
+
+	*pCount = count;
+	return SENSOR_ERROR_NONE;
+}
+
+void PCF85063AT_Bench_Print(const PCF85063AT_benchresult_t *pResults, uint32_t count)
+{
+	uint32_t i;
+
+	PRINTF("api,status,transactions,bytes,wait_cycles,time_us\r\n");
+	for (i = 0; i < count; i++)
+	{
+		PRINTF("%s,%d,%u,%u,%u,%u\r\n", pResults[i].name, (int)pResults[i].status,
+				(unsigned)pResults[i].transactions, (unsigned)pResults[i].bytes,
+				(unsigned)pResults[i].waitCycles, (unsigned)pResults[i].time_us);
+	}
+}
+
+uint32_t PCF85063AT_Bench_Check(const PCF85063AT_benchresult_t *pResults, uint32_t count,
+		const PCF85063AT_benchbudget_t *pBudget, uint32_t budgetCount)
+{
+	uint32_t i, j, regressions = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		for (j = 0; j < budgetCount; j++)
+		{
+			if (strcmp(pResults[i].name, pBudget[j].name) == 0)
+			{
+				break;
+			}
+		}
+
+		if (j == budgetCount)
+		{
+			PRINTF("FAIL,%s,no budget\r\n", pResults[i].name);
+			regressions++;
+		}
+		else if (SENSOR_ERROR_NONE != pResults[i].status)
+		{
+			PRINTF("FAIL,%s,status %d\r\n", pResults[i].name, (int)pResults[i].status);
+			regressions++;
+		}
+		else if ((pResults[i].transactions > pBudget[j].transactions) || (pResults[i].bytes > pBudget[j].bytes))
+		{
+			PRINTF("FAIL,%s,%u/%u transactions,%u/%u bytes\r\n", pResults[i].name,
+					(unsigned)pResults[i].transactions, (unsigned)pBudget[j].transactions,
+					(unsigned)pResults[i].bytes, (unsigned)pBudget[j].bytes);
+			regressions++;
+		}
+	}
+
+	return regressions;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_bench.h
+ * @brief The pcf85063at_bench.h file declares the micro benchmark of the PCF85063AT driver APIs.
+ *        Runs on the target and on the host simulation alike, the bus cost of an API is the same on both.
+ */
+
+#ifndef PCF85063AT_BENCH_H_
+#define PCF85063AT_BENCH_H_
+
+#include "pcf85063at_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @def    PCF85063AT_BENCH_MAX_CASES
+ *  @brief  Number of results PCF85063AT_Bench_Run() can produce. */
+#define PCF85063AT_BENCH_MAX_CASES    (64)
+
+/*! @brief This structure defines the cost of one API call.*/
+typedef struct
+{
+	const char *name;          /*!< API name.*/
+	int32_t status;            /*!< Status the API returned.*/
+	uint32_t transactions;     /*!< MasterTransmit and MasterReceive calls.*/
+	uint32_t bytes;            /*!< Bytes on the wire, slave address bytes included.*/
+	uint32_t waitCycles;       /*!< Systicks spent in the wait loops of the transfers.*/
+	uint32_t time_us;          /*!< Wall time of the call.*/
+} PCF85063AT_benchresult_t;
+
+/*! @brief This structure defines the most an API may cost before it counts as a regression.*/
+typedef struct
+{
+	const char *name;          /*!< API name.*/
+	uint32_t transactions;     /*!< Most transactions allowed.*/
+	uint32_t bytes;            /*!< Most bytes on the wire allowed.*/
+} PCF85063AT_benchbudget_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*! @brief       Runs every public API of the driver once and measures it.
+ *  @details     Each API is called once to warm the shadow registers and measured on a second call, through
+ *               a counting proxy of pBus. Wait cycles are the systicks between the start of a transfer and the
+ *               last pass of the wait loop, wall time is measured with BOARD_SystickStart() and
+ *               BOARD_SystickElapsedTime_us().
+ *  @param[in]   pBus  				I2C driver, initialized with the signal event of index.
+ *  @param[in]   index  			I2C instance.
+ *  @param[in]   sAddress  			Slave address of the RTC.
+ *  @param[out]  pResults  			Array of PCF85063AT_BENCH_MAX_CASES results.
+ *  @param[out]  pCount  			Number of results written.
+ *  @constraints The SysTick must be running. Overwrites the configuration, the alarm and the time of the RTC,
+ *               which is software reset at the end.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Bench_Run() returns the status.
+ */
+int32_t PCF85063AT_Bench_Run(ARM_DRIVER_I2C *pBus, uint8_t index, uint16_t sAddress,
+		PCF85063AT_benchresult_t *pResults, uint32_t *pCount);
+
+/*! @brief       Prints the results as comma separated values, one line per API after a header line.
+ *  @param[in]   pResults  			Results.
+ *  @param[in]   count  			Number of results.
+ *  @constraints None
+ *  @reentrant   No
+ */
+void PCF85063AT_Bench_Print(const PCF85063AT_benchresult_t *pResults, uint32_t count);
+
+/*! @brief       Compares the results with a budget.
+ *  @details     Prints one line per API over its budget, failed, or without a budget.
+ *  @param[in]   pResults  			Results.
+ *  @param[in]   count  			Number of results.
+ *  @param[in]   pBudget  			Budget.
+ *  @param[in]   budgetCount  		Number of budget entries.
+ *  @constraints None
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Bench_Check() returns the number of regressions, 0 when the run is within budget.
+ */
+uint32_t PCF85063AT_Bench_Check(const PCF85063AT_benchresult_t *pResults, uint32_t count,
+		const PCF85063AT_benchbudget_t *pBudget, uint32_t budgetCount);
+
+#endif /* PCF85063AT_BENCH_H_ */
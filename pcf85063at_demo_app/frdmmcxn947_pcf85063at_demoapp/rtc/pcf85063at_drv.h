@@ -12,6 +12,7 @@
 #ifndef PCF85063AT_DRV_H_
 #define PCF85063AT_DRV_H_
 
+#include <stddef.h>
 #include "pcf85063at.h"
 #include "sensor_io_i2c.h"
 #include "register_io_i2c.h"
@@ -236,15 +237,160 @@ typedef struct
 	AmPm     ampm;
 } PCF85063AT_timedata_t;
 
+/*! @brief This structure defines a countdown timer setting computed by PCF85063AT_TimerPlan().*/
+typedef struct
+{
+	TCF      tcf;            /*!< Source clock of the timer.*/
+	uint8_t  value;          /*!< Timer_value, 1 to 255.*/
+	uint64_t period_us;      /*!< Period the setting gives, rounded to the microsecond.*/
+	int32_t  error_us;       /*!< period_us minus the requested duration.*/
+} PCF85063AT_timerplan_t;
+
+/*! @brief This structure defines the raw Seconds to Years registers (0x04 - 0x0A), BCD as on the bus.
+ *         Every member is a byte, so it has no padding and is read or written in one burst.*/
+typedef struct
+{
+	uint8_t  seconds;        /*!< Seconds and OS flag (0x04).*/
+	uint8_t  minutes;        /*!< Minutes (0x05).*/
+	uint8_t  hours;          /*!< Hours, AMPM in 12h mode (0x06).*/
+	uint8_t  days;           /*!< Days (0x07).*/
+	uint8_t  weekdays;       /*!< Weekdays (0x08).*/
+	uint8_t  months;         /*!< Months (0x09).*/
+	uint8_t  years;          /*!< Years (0x0A).*/
+} PCF85063AT_timeframe_t;
+
+/*! @brief This structure defines the raw Control_1 to Years registers (0x00 - 0x0A), the time with the mode it
+ *         is coded in.*/
+typedef struct
+{
+	uint8_t  ctrl1;                  /*!< Control_1 (0x00).*/
+	uint8_t  ctrl2;                  /*!< Control_2 (0x01).*/
+	uint8_t  offset;                 /*!< Offset (0x02).*/
+	uint8_t  ramByte;                /*!< RAM_byte (0x03).*/
+	PCF85063AT_timeframe_t time;     /*!< Seconds to Years (0x04 - 0x0A).*/
+} PCF85063AT_timeburst_t;
+
+/*! @brief This structure defines the raw Second_alarm to Weekday_alarm registers (0x0B - 0x0F), BCD with the
+ *         AEN_x bit in bit 7.*/
+typedef struct
+{
+	uint8_t  second;         /*!< Second_alarm (0x0B).*/
+	uint8_t  minute;         /*!< Minute_alarm (0x0C).*/
+	uint8_t  hour;           /*!< Hour_alarm, AMPM in 12h mode (0x0D).*/
+	uint8_t  day;            /*!< Day_alarm (0x0E).*/
+	uint8_t  weekday;        /*!< Weekday_alarm (0x0F).*/
+} PCF85063AT_alarmframe_t;
+
+/*! @brief This structure defines the raw Timer_value and Timer_mode registers (0x10 - 0x11).*/
+typedef struct
+{
+	uint8_t  value;          /*!< Timer_value (0x10).*/
+	uint8_t  mode;           /*!< Timer_mode (0x11).*/
+} PCF85063AT_timerframe_t;
+
+/*! @brief This structure defines the register file of the PCF85063AT RTC, one byte per register in address order.
+ *         It is made of the frames above, so it is read in one burst and its parts decoded in place.*/
+typedef struct
+{
+	uint8_t  ctrl1;                  /*!< Control_1 (0x00).*/
+	uint8_t  ctrl2;                  /*!< Control_2 (0x01).*/
+	uint8_t  offset;                 /*!< Offset (0x02).*/
+	uint8_t  ramByte;                /*!< RAM_byte (0x03).*/
+	PCF85063AT_timeframe_t time;     /*!< Seconds to Years (0x04 - 0x0A).*/
+	PCF85063AT_alarmframe_t alarm;   /*!< Second_alarm to Weekday_alarm (0x0B - 0x0F).*/
+	PCF85063AT_timerframe_t timer;   /*!< Timer_value and Timer_mode (0x10 - 0x11).*/
+} PCF85063AT_snapshot_t;
+
+/*--------------------------------
+ ** Enum: PCF85063AT_FIELD
+ ** @brief: Register fields compared by PCF85063AT_SnapshotDiff()
+ ** ------------------------------*/
+typedef enum PCF85063AT_FIELD
+{
+	PCF85063AT_FIELD_EXT_TEST = 0x00,      /* Control_1 EXT_TEST */
+	PCF85063AT_FIELD_STOP = 0x01,          /* Control_1 STOP */
+	PCF85063AT_FIELD_CIE = 0x02,           /* Control_1 CIE */
+	PCF85063AT_FIELD_12_24 = 0x03,         /* Control_1 12_24 */
+	PCF85063AT_FIELD_CAP_SEL = 0x04,       /* Control_1 CAP_SEL */
+	PCF85063AT_FIELD_AIE = 0x05,           /* Control_2 AIE */
+	PCF85063AT_FIELD_AF = 0x06,            /* Control_2 AF */
+	PCF85063AT_FIELD_MI = 0x07,            /* Control_2 MI */
+	PCF85063AT_FIELD_HMI = 0x08,           /* Control_2 HMI */
+	PCF85063AT_FIELD_TF = 0x09,            /* Control_2 TF */
+	PCF85063AT_FIELD_COF = 0x0A,           /* Control_2 COF */
+	PCF85063AT_FIELD_OFFSET_MODE = 0x0B,   /* Offset MODE */
+	PCF85063AT_FIELD_OFFSET = 0x0C,        /* Offset OFFSET */
+	PCF85063AT_FIELD_RAM_BYTE = 0x0D,      /* RAM_byte */
+	PCF85063AT_FIELD_OS = 0x0E,            /* Seconds OS */
+	PCF85063AT_FIELD_SECONDS = 0x0F,       /* Seconds */
+	PCF85063AT_FIELD_MINUTES = 0x10,       /* Minutes */
+	PCF85063AT_FIELD_HOURS = 0x11,         /* Hours, AMPM included */
+	PCF85063AT_FIELD_DAYS = 0x12,          /* Days */
+	PCF85063AT_FIELD_WEEKDAYS = 0x13,      /* Weekdays */
+	PCF85063AT_FIELD_MONTHS = 0x14,        /* Months */
+	PCF85063AT_FIELD_YEARS = 0x15,         /* Years */
+	PCF85063AT_FIELD_AEN_S = 0x16,         /* Second_alarm AEN_S */
+	PCF85063AT_FIELD_SECOND_ALARM = 0x17,  /* Second_alarm */
+	PCF85063AT_FIELD_AEN_M = 0x18,         /* Minute_alarm AEN_M */
+	PCF85063AT_FIELD_MINUTE_ALARM = 0x19,  /* Minute_alarm */
+	PCF85063AT_FIELD_AEN_H = 0x1A,         /* Hour_alarm AEN_H */
+	PCF85063AT_FIELD_HOUR_ALARM = 0x1B,    /* Hour_alarm, AMPM included */
+	PCF85063AT_FIELD_AEN_D = 0x1C,         /* Day_alarm AEN_D */
+	PCF85063AT_FIELD_DAY_ALARM = 0x1D,     /* Day_alarm */
+	PCF85063AT_FIELD_AEN_W = 0x1E,         /* Weekday_alarm AEN_W */
+	PCF85063AT_FIELD_WEEKDAY_ALARM = 0x1F, /* Weekday_alarm */
+	PCF85063AT_FIELD_TIMER_VALUE = 0x20,   /* Timer_value */
+	PCF85063AT_FIELD_TCF = 0x21,           /* Timer_mode TCF */
+	PCF85063AT_FIELD_TE = 0x22,            /* Timer_mode TE */
+	PCF85063AT_FIELD_TIE = 0x23,           /* Timer_mode TIE */
+	PCF85063AT_FIELD_TI_TP = 0x24,         /* Timer_mode TI_TP */
+	PCF85063AT_FIELD_COUNT = 0x25,
+}PCF85063AT_FIELD;
 
 /*! @def    PCF85063AT_TIME_SIZE_BYTE
  *  @brief  The size of time. */
 #define PCF85063AT_TIME_SIZE_BYTE    (7)
 
+/*! @def    PCF85063AT_TIME_BURST_SIZE_BYTE
+ *  @brief  The size of the Control_1 to Years burst. */
+#define PCF85063AT_TIME_BURST_SIZE_BYTE    (11)
+
+/*! @def    PCF85063AT_EPOCH_2000
+ *  @brief  Unix time of 2000-01-01 00:00:00, the first second the RTC can hold. */
+#define PCF85063AT_EPOCH_2000    (946684800U)
+
+/*! @def    PCF85063AT_EPOCH_2100
+ *  @brief  Unix time of 2100-01-01 00:00:00, one past the last second the RTC can hold. */
+#define PCF85063AT_EPOCH_2100    (4102444800U)
+
+/*! @def    PCF85063AT_TIMER_MAX_US
+ *  @brief  Longest countdown timer period, 255 periods of the 1/60 Hz source clock. */
+#define PCF85063AT_TIMER_MAX_US    (15300000000ULL)
+
+/*! @def    PCF85063AT_REGISTER_COUNT
+ *  @brief  The number of registers, Control_1 (0x00) to Timer_mode (0x11). */
+#define PCF85063AT_REGISTER_COUNT    (18)
+
 /*! @def    PCF85063AT_ALARM_TIME_SIZE_BYTE
  *  @brief  The size of Alarm time. */
 #define PCF85063AT_ALARM_TIME_SIZE_BYTE    (5)
 
+/*! @def    PCF85063AT_STATIC_ASSERT
+ *  @brief  Fails the build when cond is false, through a negative array size. */
+#define PCF85063AT_STATIC_ASSERT(cond, name)    typedef char PCF85063AT_assert_##name[(cond) ? 1 : -1]
+
+/*! The raw frames match the register map byte for byte. */
+PCF85063AT_STATIC_ASSERT(sizeof(PCF85063AT_timeframe_t) == PCF85063AT_TIME_SIZE_BYTE, timeframe_size);
+PCF85063AT_STATIC_ASSERT(sizeof(PCF85063AT_timeburst_t) == PCF85063AT_TIME_BURST_SIZE_BYTE, timeburst_size);
+PCF85063AT_STATIC_ASSERT(offsetof(PCF85063AT_timeburst_t, time) == PCF85063AT_SECOND, timeburst_time);
+PCF85063AT_STATIC_ASSERT(sizeof(PCF85063AT_alarmframe_t) == PCF85063AT_ALARM_TIME_SIZE_BYTE, alarmframe_size);
+PCF85063AT_STATIC_ASSERT(sizeof(PCF85063AT_timerframe_t) == (PCF85063AT_TIMER_MODE - PCF85063AT_TIMER_VALUE + 1),
+		timerframe_size);
+PCF85063AT_STATIC_ASSERT(sizeof(PCF85063AT_snapshot_t) == PCF85063AT_REGISTER_COUNT, snapshot_size);
+PCF85063AT_STATIC_ASSERT(offsetof(PCF85063AT_snapshot_t, time) == PCF85063AT_SECOND, snapshot_time);
+PCF85063AT_STATIC_ASSERT(offsetof(PCF85063AT_snapshot_t, alarm) == PCF85063AT_SECOND_ALARM, snapshot_alarm);
+PCF85063AT_STATIC_ASSERT(offsetof(PCF85063AT_snapshot_t, timer) == PCF85063AT_TIMER_VALUE, snapshot_timer);
+
 /*! @def    PCF85063AT_12h_Mode
  *  @brief  By default 12h mode Enable. */
 #define PCF85063AT_12h_Mode    (0x04)
@@ -258,6 +404,26 @@ typedef struct
  * Definitions
  ******************************************************************************/
 
+/*--------------------------------
+ ** Enum: PCF85063AT_SHADOW
+ ** @brief: Slots of the control registers shadowed in the sensor handle
+ ** ------------------------------*/
+typedef enum PCF85063AT_SHADOW
+{
+	PCF85063AT_SHADOW_CTRL1 = 0x00,      /* Control_1 (0x00) */
+	PCF85063AT_SHADOW_CTRL2 = 0x01,      /* Control_2 (0x01), AF/TF flags are never cached */
+	PCF85063AT_SHADOW_OFFSET = 0x02,     /* Offset (0x02) */
+	PCF85063AT_SHADOW_RAM_BYTE = 0x03,   /* RAM_byte (0x03) */
+	PCF85063AT_SHADOW_TIMER_MODE = 0x04, /* Timer_mode (0x11) */
+	PCF85063AT_SHADOW_COUNT = 0x05,
+}PCF85063AT_SHADOW;
+
+/*!
+ * @brief The completion callback of the asynchronous APIs.
+ * @details Called from the I2C interrupt context with SENSOR_ERROR_NONE or the error of the transfer.
+ */
+typedef void (*PCF85063AT_asynccallback_t)(void *pUserData, int32_t status);
+
 /*!
  * @brief This defines the sensor specific information for SPI.
  */
@@ -267,6 +433,13 @@ typedef struct
 	ARM_DRIVER_I2C *pCommDrv;        /*!< Pointer to the i2c driver. */
 	bool isInitialized;                   /*!< Whether sensor is intialized or not.*/
 	uint16_t slaveAddress;           /*!< slave address.*/
+	uint8_t shadowReg[PCF85063AT_SHADOW_COUNT]; /*!< Write-through copy of the control registers.*/
+	uint8_t shadowValid;             /*!< Bit n set when shadowReg[n] matches the device.*/
+	registerAsyncTransfer_t asyncXfer;   /*!< Transfer descriptor of the asynchronous APIs.*/
+	PCF85063AT_timeburst_t asyncBurst;   /*!< Raw registers of the asynchronous read.*/
+	PCF85063AT_timedata_t *pAsyncTime;   /*!< Destination of the asynchronous read.*/
+	PCF85063AT_asynccallback_t volatile asyncCallback; /*!< Callback of the pending asynchronous request, NULL when idle.*/
+	void *pAsyncUserData;            /*!< Parameter passed to asyncCallback.*/
 }  PCF85063AT_sensorhandle_t;
 
 
@@ -321,6 +494,29 @@ int32_t PCF85063AT_Initialize(PCF85063AT_sensorhandle_t *pSensorHandle, ARM_DRIV
  */
 void PCF85063AT_SetIdleTask(PCF85063AT_sensorhandle_t *pSensorHandle, registeridlefunction_t idleTask, void *userParam);
 
+/*! @brief       Sets the longest wait for one bus transfer of the PCF85063AT RTC.
+ *  @details     A transfer not complete in time is aborted and the bus is recovered, see Register_I2C_Recover().
+ *               The API returns its read or write error, the timeout is counted in the register I/O counters.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   timeoutUs  		Timeout in microseconds, 0 for REGISTER_IO_TIMEOUT_US.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 The SysTick must run, see BOARD_SystickEnable().
+ *  @reentrant   No
+ */
+void PCF85063AT_SetTimeout(PCF85063AT_sensorhandle_t *pSensorHandle, uint32_t timeoutUs);
+
+/*! @brief       Sets how the PCF85063AT RTC APIs wait for their bus transfers.
+ *  @details     REGISTER_WAIT_WFE and REGISTER_WAIT_WFI sleep until the next interrupt. The SysTick interrupt
+ *               is armed at the deadline, see BOARD_SystickSetWakeup(), so that a stuck bus still times out.
+ *               They spin the last 10 us before it, and when no wake-up can be armed and the SysTick wrap
+ *               comes after it. Retry backoffs do not sleep.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   waitMode  			Wait mode, REGISTER_WAIT_YIELD after PCF85063AT_Initialize().
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *  @reentrant   No
+ */
+void PCF85063AT_SetWaitMode(PCF85063AT_sensorhandle_t *pSensorHandle, registerWaitMode_t waitMode);
+
 /*! @brief       Configures the PCF85063AT RTC.
  *  @details     Initializes the PCF85063AT sensor and its handle.
  *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
@@ -332,6 +528,32 @@ void PCF85063AT_SetIdleTask(PCF85063AT_sensorhandle_t *pSensorHandle, registerid
  */
 int32_t PCF85063AT_Configure(PCF85063AT_sensorhandle_t *pSensorHandle, const registerwritelist_t *pRegWriteList);
 
+/*! @brief       Updates a register of the PCF85063AT RTC.
+ *  @details     Updates the bits selected by mask with value. CTRL1, CTRL2, OFFSET, RAM_BYTE and TIMER_MODE
+ *               are served from the write-through shadow in the handle, so a masked update costs a single
+ *               write once the shadow is valid. The AF/TF flags of CTRL2 are written as 1 (unchanged) unless
+ *               they are part of mask. Other registers fall back to a read-modify-write on the bus.
+ *               A mask of zero overwrites the register with value.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   offset  			Register address.
+ *  @param[in]   value  			Value to write, already shifted to the field position.
+ *  @param[in]   mask  				Mask of the field to update.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_UpdateRegister() returns the status.
+ */
+int32_t PCF85063AT_UpdateRegister(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t offset, uint8_t value, uint8_t mask);
+
+/*! @brief       Invalidates the register shadow of the PCF85063AT RTC.
+ *  @details     Forces the next update of every shadowed register to be read back from the device.
+ *               Call this when the registers were changed behind the driver's back.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *  @reentrant   No
+ */
+void PCF85063AT_InvalidateShadow(PCF85063AT_sensorhandle_t *pSensorHandle);
+
 /*! @brief       De-initializes the PCF85063AT RTC.
  *  @details     De-initializes the PCF85063AT sensor and its handle.
  *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
@@ -446,19 +668,184 @@ int32_t PCF85063AT_SwRst(PCF85063AT_sensorhandle_t *pSensorHandle);
  *  @return      ::PCF85063AT_TimeStamp_On() returns the status.
  */
 
+/*! The read list must read the PCF85063AT_timeframe_t registers from Seconds, SENSOR_ERROR_INVALID_PARAM otherwise. */
 int32_t PCF85063AT_GetTime(PCF85063AT_sensorhandle_t *pSensorHandle,const registerreadlist_t  *PCF85063ATtimedata, PCF85063AT_timedata_t *time );
 
+/*! @brief       Gets the current time, 12h/24h mode and oscillator stop flag of the PCF85063AT RTC.
+ *  @details     Reads Control_1 to Years in a single burst and decodes mode, time and the OS flag
+ *               from the same snapshot, so the time cannot be decoded with a stale mode.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[out]  time  				Pointer to the decoded time.
+ *  @param[out]  pmode_12_24  		Pointer to the 12h/24h mode, may be NULL.
+ *  @param[out]  pOscStopped  		Pointer to the OS flag, true when clock integrity is not guaranteed. May be NULL.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_GetTimeCoherent() returns SENSOR_ERROR_READ when a field is not valid BCD or out
+ *               of range, time is decoded anyway.
+ */
+int32_t PCF85063AT_GetTimeCoherent(PCF85063AT_sensorhandle_t *pSensorHandle, PCF85063AT_timedata_t *time, Mode12h_24h *pmode_12_24, bool *pOscStopped);
+
+/*! @brief       Starts reading the current time of the PCF85063AT RTC without blocking.
+ *  @details     Starts the same Control_1 to Years burst as PCF85063AT_GetTimeCoherent() and returns immediately.
+ *               The data phase is chained from the I2C Signal Event Handler, time is decoded and callback is
+ *               called from the interrupt context once the transfer has completed.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[out]  time  				Pointer to the decoded time, valid when callback reports SENSOR_ERROR_NONE.
+ *  @param[in]   callback  			Completion callback.
+ *  @param[in]   pUserData  		Parameter passed to callback.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 No other API may be called with this handle until callback has run. A blocking API called on this
+ *				 bus meanwhile waits for the transfer to end.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_GetTimeAsync() returns SENSOR_ERROR_BUSY when a request is already pending.
+ */
+int32_t PCF85063AT_GetTimeAsync(PCF85063AT_sensorhandle_t *pSensorHandle, PCF85063AT_timedata_t *time,
+		PCF85063AT_asynccallback_t callback, void *pUserData);
+
+/*! @brief       Starts setting the current time of the PCF85063AT RTC without blocking.
+ *  @details     Encodes time and starts the same burst write as PCF85063AT_SetTime(), then returns immediately.
+ *               callback is called from the interrupt context once the transfer has completed.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   time  				Pointer to the time to set, no longer referenced once this returns.
+ *  @param[in]   callback  			Completion callback.
+ *  @param[in]   pUserData  		Parameter passed to callback.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 No other API may be called with this handle until callback has run. A blocking API called on this
+ *				 bus meanwhile waits for the transfer to end.
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_SetTimeAsync() returns SENSOR_ERROR_BUSY when a request is already pending,
+ *               SENSOR_ERROR_INVALID_PARAM when a field is out of range, see PCF85063AT_TimeToBcd().
+ */
+int32_t PCF85063AT_SetTimeAsync(PCF85063AT_sensorhandle_t *pSensorHandle, const PCF85063AT_timedata_t *time,
+		PCF85063AT_asynccallback_t callback, void *pUserData);
+
 /*! @brief       Sets the time from the PCF85063AT RTC.
- *  @details     Sets the current time in the RTC registers.
+ *  @details     Sets the current time in the RTC registers (Seconds to Years) with a single burst write.
  *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
  *  @param[in]   time    			Pointer to the time data to be set.
  *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
  *				 Application has to ensure that previous instances of these APIs have exited before invocation
  *  @reentrant   No
- *  @return      ::PCF85063AT_SetTime() returns the status.
+ *  @return      ::PCF85063AT_SetTime() returns SENSOR_ERROR_INVALID_PARAM when a field is out of range, see
+ *               PCF85063AT_TimeToBcd().
  */
 int32_t PCF85063AT_SetTime(PCF85063AT_sensorhandle_t *pSensorHandle, PCF85063AT_timedata_t *time);
 
+/*! @brief       Converts a value from 0 to 99 to BCD, one field at a time.
+ *  @param[in]   val  				Value to convert.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::DecimaltoBcd() returns the BCD value.
+ */
+uint8_t DecimaltoBcd(uint8_t val);
+
+/*! @brief       Converts a BCD value to binary, one field at a time.
+ *  @param[in]   val  				BCD value to convert.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::BcdToDecimal() returns the binary value.
+ */
+uint8_t BcdToDecimal(uint8_t val);
+
+/*! @brief       Encodes a time into the Seconds to Years registers.
+ *  @details     The seven fields are packed into one 64-bit word and converted and range checked together, no
+ *               division. Hours are 1 to 12 when ampm is AM or PM, 0 to 23 otherwise. The day must exist in
+ *               the month.
+ *  @param[in]   time  				Pointer to the time to encode.
+ *  @param[out]  raw  				Pointer to the Seconds to Years registers.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_TimeToBcd() returns SENSOR_ERROR_INVALID_PARAM when a field is out of range.
+ */
+int32_t PCF85063AT_TimeToBcd(const PCF85063AT_timedata_t *time, PCF85063AT_timeframe_t *raw);
+
+/*! @brief       Decodes the Seconds to Years registers into a time.
+ *  @details     The seven registers are packed into one 64-bit word, their BCD nibbles and ranges checked and
+ *               converted together. The OS flag is dropped. Decodes straight from the buffer a burst or a DMA
+ *               transfer filled, e.g. the time of a PCF85063AT_snapshot_t.
+ *  @param[in]   raw  				Pointer to the Seconds to Years registers.
+ *  @param[in]   mode12_24  		Format of the hours register.
+ *  @param[out]  time  				Pointer to the decoded time, filled even when a field is not valid.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_BcdToTime() returns SENSOR_ERROR_INVALID_PARAM when a nibble is above 9 or a field
+ *               is out of range.
+ */
+int32_t PCF85063AT_BcdToTime(const PCF85063AT_timeframe_t *raw, Mode12h_24h mode12_24, PCF85063AT_timedata_t *time);
+
+/*! @brief       Encodes an alarm time into the Second_alarm to Weekday_alarm registers.
+ *  @details     The fields from alarmtype to weekday are enabled, as PCF85063AT_AlarmInt_Enable() does, the
+ *               ones before it have their AEN_x bit set. The frame is written with PCF85063AT_SetAlarmFrame().
+ *  @param[in]   alarmtime  		Pointer to the alarm time, hours in 12h format when ampm is AM or PM.
+ *  @param[in]   alarmtype  		First enabled field, A_Seconds enables them all.
+ *  @param[out]  raw  				Pointer to the Second_alarm to Weekday_alarm registers.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_AlarmToBcd() returns SENSOR_ERROR_INVALID_PARAM when a field is out of range.
+ */
+int32_t PCF85063AT_AlarmToBcd(const PCF85063AT_alarmdata_t *alarmtime, AlarmType alarmtype,
+		PCF85063AT_alarmframe_t *raw);
+
+/*! @brief       Decodes the Second_alarm to Weekday_alarm registers into an alarm time.
+ *  @details     The alarm enable bits are dropped, a disabled alarm register decodes as it is stored.
+ *  @param[in]   raw  				Pointer to the Second_alarm to Weekday_alarm registers.
+ *  @param[in]   mode12_24  		Format of the hours register.
+ *  @param[out]  alarmtime  		Pointer to the decoded alarm time.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_BcdToAlarm() returns the status.
+ */
+int32_t PCF85063AT_BcdToAlarm(const PCF85063AT_alarmframe_t *raw, Mode12h_24h mode12_24,
+		PCF85063AT_alarmdata_t *alarmtime);
+
+/*! @brief       Converts a PCF85063AT time to Unix time.
+ *  @details     Years are taken as 2000 to 2099, 12h times are converted using ampm. The day count comes from
+ *               a cumulative days table, only 32-bit multiplications are used.
+ *  @param[in]   time  				Pointer to the time to convert.
+ *  @param[out]  pEpoch  			Pointer to the seconds since 1970-01-01 00:00:00 UTC.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_TimeToEpoch() returns SENSOR_ERROR_INVALID_PARAM for an out of range field or a day
+ *               past the end of the month.
+ */
+int32_t PCF85063AT_TimeToEpoch(const PCF85063AT_timedata_t *time, uint32_t *pEpoch);
+
+/*! @brief       Converts Unix time to a PCF85063AT time.
+ *  @details     Fills every field of time, weekday included, in 12h or 24h format.
+ *               Only 32-bit divisions by constants are used.
+ *  @param[in]   epoch  			Seconds since 1970-01-01 00:00:00 UTC, PCF85063AT_EPOCH_2000 to PCF85063AT_EPOCH_2100 - 1.
+ *  @param[in]   mode12_24  		Format of the hours field.
+ *  @param[out]  time  				Pointer to the converted time.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_EpochToTime() returns SENSOR_ERROR_INVALID_PARAM when epoch is out of range.
+ */
+int32_t PCF85063AT_EpochToTime(uint32_t epoch, Mode12h_24h mode12_24, PCF85063AT_timedata_t *time);
+
+/*! @brief       Gets the current time of the PCF85063AT RTC as Unix time.
+ *  @details     Reads the time with PCF85063AT_GetTimeCoherent() and converts it, whatever the 12h/24h mode.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[out]  pEpoch  			Pointer to the seconds since 1970-01-01 00:00:00 UTC.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_GetEpoch() returns the status.
+ */
+int32_t PCF85063AT_GetEpoch(PCF85063AT_sensorhandle_t *pSensorHandle, uint32_t *pEpoch);
+
+/*! @brief       Sets the current time of the PCF85063AT RTC from Unix time.
+ *  @details     Converts epoch in the current 12h/24h mode of the RTC, weekday included, and writes it
+ *               with PCF85063AT_SetTime().
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   epoch  			Seconds since 1970-01-01 00:00:00 UTC, PCF85063AT_EPOCH_2000 to PCF85063AT_EPOCH_2100 - 1.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_SetEpoch() returns the status.
+ */
+int32_t PCF85063AT_SetEpoch(PCF85063AT_sensorhandle_t *pSensorHandle, uint32_t epoch);
+
 /*! @brief       Gets the timestamp from the PCF85063AT RTC.
  *  @details     Reads the timestampfor the specified timestamp number.
  *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
@@ -484,6 +871,165 @@ int32_t PCF85063AT_12h_24h_Mode_Set(PCF85063AT_sensorhandle_t *pSensorHandle, Mo
  */
 int32_t PCF85063AT_12h_24h_Mode_Get(PCF85063AT_sensorhandle_t *pSensorHandle, Mode12h_24h *pmode_12_24);
 
+/*! @brief       Reads Control_2 of the PCF85063AT RTC.
+ *  @details     Returns the AF/TF flags together with the interrupt enables in one read.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[out]  pCtrl2  			Pointer to the Control_2 value.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Get_Ctrl2() returns the status.
+ */
+int32_t PCF85063AT_Get_Ctrl2(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t *pCtrl2);
+
+/*! @brief       Reads Timer_mode of the PCF85063AT RTC.
+ *  @details     Returns the shadowed value without a bus access once it is known, Timer_mode is only changed
+ *               through this driver.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[out]  pTimerMode  		Pointer to the Timer_mode value.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Get_TimerMode() returns the status.
+ */
+int32_t PCF85063AT_Get_TimerMode(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t *pTimerMode);
+
+/*! @brief       Reads Timer_value of the PCF85063AT RTC.
+ *  @details     While the countdown timer runs the current countdown value is returned, not the value it was
+ *               loaded with, so this always reads the device.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[out]  pTimerValue  		Pointer to the Timer_value value.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Get_TimerValue() returns the status.
+ */
+int32_t PCF85063AT_Get_TimerValue(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t *pTimerValue);
+
+/*! @brief       Clears interrupt flags of the PCF85063AT RTC.
+ *  @details     Clears the flags selected by flags (PCF85063AT_CTRL2_AF_MASK, PCF85063AT_CTRL2_TF_MASK) in a
+ *               single write, the other flags are left untouched.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   flags  			Flags to clear.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Clear_Flags() returns the status.
+ */
+int32_t PCF85063AT_Clear_Flags(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t flags);
+
+/*! @brief       Loads and starts the countdown timer of the PCF85063AT RTC with its interrupt enabled.
+ *  @details     A running timer is stopped first, Timer_value must not change while TE is set. Timer_value and
+ *               Timer_mode are then written in one burst, TI_TP is kept.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   tcf  				Source clock of the timer.
+ *  @param[in]   value  			Source clock periods until TF is set, 1 to 255.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Countdown_Start() returns the status.
+ */
+int32_t PCF85063AT_Countdown_Start(PCF85063AT_sensorhandle_t *pSensorHandle, TCF tcf, uint8_t value);
+
+/*! @brief       Stops the countdown timer of the PCF85063AT RTC and disables its interrupt.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Countdown_Stop() returns the status.
+ */
+int32_t PCF85063AT_Countdown_Stop(PCF85063AT_sensorhandle_t *pSensorHandle);
+
+/*! @brief       Computes the countdown timer setting closest to a duration.
+ *  @details     Tries every source clock, 4.096 kHz, 64 Hz, 1 Hz and 1/60 Hz, with the rounded Timer_value and
+ *               keeps the one with the smallest error, the finer source clock on a tie. Integer arithmetic only.
+ *               The first period of a started timer may be shorter by up to one source clock period.
+ *  @param[in]   duration_us  		Duration in microseconds, 1 to PCF85063AT_TIMER_MAX_US.
+ *  @param[out]  pPlan  			Pointer to the setting and its error.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_TimerPlan() returns SENSOR_ERROR_INVALID_PARAM when duration_us is out of range.
+ */
+int32_t PCF85063AT_TimerPlan(uint64_t duration_us, PCF85063AT_timerplan_t *pPlan);
+
+/*! @brief       Applies a countdown timer setting to the PCF85063AT RTC.
+ *  @details     Timer_value and Timer_mode are written in one burst. TE, TIE and TI_TP are kept: a stopped timer
+ *               stays stopped, a running one is stopped first and restarted by the burst.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   pPlan  			Pointer to the setting from PCF85063AT_TimerPlan().
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_TimerPlan_Apply() returns the status.
+ */
+int32_t PCF85063AT_TimerPlan_Apply(PCF85063AT_sensorhandle_t *pSensorHandle, const PCF85063AT_timerplan_t *pPlan);
+
+/*! @brief       Reads the Offset register of the PCF85063AT RTC.
+ *  @details     MODE and OFFSET together, from the shadow when it is valid.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[out]  pOffset  			Pointer to the Offset register value.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Get_Offset() returns the status.
+ */
+int32_t PCF85063AT_Get_Offset(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t *pOffset);
+
+/*! @brief       Reads the register file of the PCF85063AT RTC.
+ *  @details     Reads the 18 registers in one burst and refreshes the register shadow with the control registers.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[out]  pSnapshot  		Pointer to the registers read.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Snapshot() returns the status.
+ */
+int32_t PCF85063AT_Snapshot(PCF85063AT_sensorhandle_t *pSensorHandle, PCF85063AT_snapshot_t *pSnapshot);
+
+/*! @brief       Decodes the time and the alarm of a register file snapshot.
+ *  @details     Converts from BCD in the 12h/24h mode recorded in the snapshot, as PCF85063AT_GetTimeCoherent()
+ *               and PCF85063AT_GetAlarmTime() do. The alarm enable bits are dropped.
+ *  @param[in]   pSnapshot  		Pointer to the snapshot.
+ *  @param[out]  time  				Pointer to the time, NULL when not needed.
+ *  @param[out]  alarmtime  		Pointer to the alarm time, NULL when not needed.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_Snapshot_Decode() returns SENSOR_ERROR_INVALID_PARAM when the time is not valid,
+ *               see PCF85063AT_BcdToTime().
+ */
+int32_t PCF85063AT_Snapshot_Decode(const PCF85063AT_snapshot_t *pSnapshot, PCF85063AT_timedata_t *time,
+		PCF85063AT_alarmdata_t *alarmtime);
+
+/*! @brief       Gets a field of a register file snapshot.
+ *  @param[in]   pSnapshot  		Pointer to the snapshot.
+ *  @param[in]   field  			Field to get.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_Snapshot_GetField() returns the raw field shifted to bit 0, 0 for an invalid field.
+ */
+uint8_t PCF85063AT_Snapshot_GetField(const PCF85063AT_snapshot_t *pSnapshot, PCF85063AT_FIELD field);
+
+/*! @brief       Gets the name of a register field, e.g. "CTRL2.AF".
+ *  @param[in]   field  			Field.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_FieldName() returns the name, "?" for an invalid field.
+ */
+const char *PCF85063AT_FieldName(PCF85063AT_FIELD field);
+
+/*! @brief       Lists the fields which differ between two register file snapshots.
+ *  @details     Fields are listed in address order, up to maxFields of them.
+ *  @param[in]   pOld  				Pointer to the earlier snapshot.
+ *  @param[in]   pNew  				Pointer to the later snapshot.
+ *  @param[out]  pFields  			Array of maxFields changed fields, may be NULL when maxFields is 0.
+ *  @param[in]   maxFields  		Size of pFields.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_SnapshotDiff() returns the number of changed fields, which may exceed maxFields.
+ */
+uint32_t PCF85063AT_SnapshotDiff(const PCF85063AT_snapshot_t *pOld, const PCF85063AT_snapshot_t *pNew,
+		PCF85063AT_FIELD *pFields, uint32_t maxFields);
+
 /*! @brief       Sets the 100th second mode for the PCF85063AT RTC.
  *  @details     Sets the 100th second mode(Enable/Disable) for the PCF85063AT RTC.
  *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
@@ -533,7 +1079,7 @@ int32_t PCF85063AT_AlarmInt_Disable(PCF85063AT_sensorhandle_t *pSensorHandle);
 /*! @brief       Get Alarm Time for PCF85063AT RTC.
  *  @details     Get Alarm functionality for PCF85063AT RTC .
  *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
- *  @param[in]   PCF85063ATalarmdata   Alarm Data
+ *  @param[in]   PCF85063ATalarmdata   Alarm Data, reading the PCF85063AT_alarmframe_t registers from Second_alarm.
  *  @param[in]   alarmtime          Time to be set for alarm functionality
  *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
  *				 Application has to ensure that previous instances of these APIs have exited before invocation
@@ -555,6 +1101,18 @@ int32_t PCF85063AT_GetAlarmTime(PCF85063AT_sensorhandle_t *pSensorHandle,const r
  */
 int32_t PCF85063AT_SetAlarmTime(PCF85063AT_sensorhandle_t *pSensorHandle, PCF85063AT_alarmdata_t *alarmtime);
 
+/*! @brief       Writes the alarm registers of the PCF85063AT RTC.
+ *  @details     Second_alarm to Weekday_alarm, AEN_x bits included, are written in one burst. AIE is left as it
+ *               is, see PCF85063AT_AlarmInt_Enable().
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @param[in]   raw  				Pointer to the frame, e.g. from PCF85063AT_AlarmToBcd().
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_SetAlarmFrame() returns the status.
+ */
+int32_t PCF85063AT_SetAlarmFrame(PCF85063AT_sensorhandle_t *pSensorHandle, const PCF85063AT_alarmframe_t *raw);
+
 /*! @brief       Disable Battery Switch Over Timestamps for PCF85063AT RTC.
  *  @details     Disable Battery Switch Over Timestamps functionality for PCF85063AT RTC .
  *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * pcf85063at_events.c
+ *
+ * @file pcf85063at_events.c
+ * @brief The pcf85063at_events.c file implements the INTB event dispatcher of the PCF85063AT RTC.
+ */
+
+#include <string.h>
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+
+#include "issdk_hal.h"
+#include "pcf85063at_events.h"
+#include "systick_utils.h"
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+
+int32_t PCF85063AT_Event_Init(PCF85063AT_eventdispatcher_t *pDispatcher, PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	/*! Validate for the correct dispatcher and handle.*/
+	if ((pDispatcher == NULL) || (pSensorHandle == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	memset(pDispatcher, 0, sizeof(PCF85063AT_eventdispatcher_t));
+	pDispatcher->pSensorHandle = pSensorHandle;
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Event_Register(PCF85063AT_eventdispatcher_t *pDispatcher, PCF85063AT_EVENT event,
+		PCF85063AT_eventhandler_t handler, void *pUserData)
+{
+	/*! Validate for the correct dispatcher and event.*/
+	if ((pDispatcher == NULL) || (event >= PCF85063AT_EVENT_COUNT))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	pDispatcher->handler[event] = handler;
+	pDispatcher->pUserData[event] = pUserData;
+
+	return SENSOR_ERROR_NONE;
+}
+
+void PCF85063AT_Event_OnInterrupt(PCF85063AT_eventdispatcher_t *pDispatcher)
+{
+	/*! The latency is measured from the first edge not processed yet. */
+	if (pDispatcher->pending == 0)
+	{
+		pDispatcher->isrTick = BOARD_SystickGetTicks();
+	}
+	pDispatcher->pending++;
+}
+
+int32_t PCF85063AT_Event_Process(PCF85063AT_eventdispatcher_t *pDispatcher, bool force)
+{
+	int32_t status;
+	uint32_t primask, pending, isrTick, latency;
+	uint8_t events = 0;
+	uint8_t event;
+	PCF85063AT_CTRL_2 Ctrl2_Reg;
+	PCF85063AT_TIMER_mode TimerMode_Reg;
+	PCF85063AT_eventstats_t *pStats;
+
+	/*! Validate for the correct dispatcher.*/
+	if (pDispatcher == NULL)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Take the pending edges, later ones are recorded for the next call. */
+	primask = DisableGlobalIRQ();
+	pending = pDispatcher->pending;
+	isrTick = pDispatcher->isrTick;
+	pDispatcher->pending = 0;
+	EnableGlobalIRQ(primask);
+
+	if ((pending == 0) && (force != true))
+	{
+		return SENSOR_ERROR_NONE;
+	}
+
+	/*! Flags and interrupt enables in a single read. */
+	status = PCF85063AT_Get_Ctrl2(pDispatcher->pSensorHandle, &Ctrl2_Reg.w);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	if (Ctrl2_Reg.b.af)
+	{
+		events |= (1U << PCF85063AT_EVENT_ALARM);
+	}
+	/*! TF is shared by the minute, half minute and countdown timer interrupts, report every enabled source. */
+	if (Ctrl2_Reg.b.tf)
+	{
+		status = PCF85063AT_Get_TimerMode(pDispatcher->pSensorHandle, &TimerMode_Reg.w);
+		if (SENSOR_ERROR_NONE != status)
+		{
+			return status;
+		}
+		if (Ctrl2_Reg.b._mi)
+		{
+			events |= (1U << PCF85063AT_EVENT_MINUTE);
+		}
+		if (Ctrl2_Reg.b._hmi)
+		{
+			events |= (1U << PCF85063AT_EVENT_HALF_MINUTE);
+		}
+		/*! A running timer without TIE is polled, TF can then only be its own. */
+		if (TimerMode_Reg.b._te && (TimerMode_Reg.b._tie || !(Ctrl2_Reg.b._mi || Ctrl2_Reg.b._hmi)))
+		{
+			events |= (1U << PCF85063AT_EVENT_TIMER);
+		}
+	}
+
+	if (events == 0)
+	{
+		if (pending)
+		{
+			pDispatcher->spurious++;
+		}
+		return SENSOR_ERROR_NONE;
+	}
+
+	/*! Clear before dispatching, so that an event raised while a handler runs is not lost. */
+	status = PCF85063AT_Clear_Flags(pDispatcher->pSensorHandle, Ctrl2_Reg.w & PCF85063AT_CTRL2_FLAGS_MASK);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	for (event = 0; event < PCF85063AT_EVENT_COUNT; event++)
+	{
+		if (!(events & (1U << event)))
+		{
+			continue;
+		}
+
+		pStats = &pDispatcher->stats[event];
+		pStats->count++;
+		if (pending)
+		{
+			latency = BOARD_SystickGetTicks() - isrTick;
+			pStats->lastLatency = latency;
+			pStats->totalLatency += latency;
+			if (latency > pStats->maxLatency)
+			{
+				pStats->maxLatency = latency;
+			}
+		}
+
+		if (pDispatcher->handler[event])
+		{
+			pDispatcher->handler[event]((PCF85063AT_EVENT)event, pDispatcher->pUserData[event]);
+		}
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Event_GetStats(PCF85063AT_eventdispatcher_t *pDispatcher, PCF85063AT_EVENT event,
+		PCF85063AT_eventstats_t *pStats)
+{
+	/*! Validate for the correct dispatcher, event and counters variable.*/
+	if ((pDispatcher == NULL) || (event >= PCF85063AT_EVENT_COUNT) || (pStats == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	*pStats = pDispatcher->stats[event];
+
+	return SENSOR_ERROR_NONE;
+}
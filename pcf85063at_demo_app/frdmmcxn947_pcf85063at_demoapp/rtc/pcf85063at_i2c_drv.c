@@ -25,6 +25,12 @@
 //-----------------------------------------------------------------------
 bool repeatedStart = 1;
 
+/*! Days before the first of each month, for common and leap years. */
+static const uint16_t s_cumulativeDays[2][13] = {
+	{0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},
+	{0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366},
+};
+
 //-----------------------------------------------------------------------
 // Functions
 //-----------------------------------------------------------------------
@@ -41,6 +47,117 @@ uint8_t BcdToDecimal(uint8_t val)
 }
 
 
+/*! Map a register address to its shadow slot, -1 when the register is not shadowed. */
+static int32_t PCF85063AT_ShadowIndex(uint8_t offset)
+{
+	switch (offset)
+	{
+	case PCF85063AT_CTRL1:
+		return PCF85063AT_SHADOW_CTRL1;
+	case PCF85063AT_CTRL2:
+		return PCF85063AT_SHADOW_CTRL2;
+	case PCF85063AT_OFFSET:
+		return PCF85063AT_SHADOW_OFFSET;
+	case PCF85063AT_RAM_BYTE:
+		return PCF85063AT_SHADOW_RAM_BYTE;
+	case PCF85063AT_TIMER_MODE:
+		return PCF85063AT_SHADOW_TIMER_MODE;
+	default:
+		return -1;
+	}
+}
+
+/*! Refresh a shadow slot from a value read on the bus. The CTRL2 status flags are not cached. */
+static void PCF85063AT_ShadowStore(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t offset, uint8_t value)
+{
+	int32_t index = PCF85063AT_ShadowIndex(offset);
+
+	if (index < 0)
+	{
+		return;
+	}
+	if (index == PCF85063AT_SHADOW_CTRL2)
+	{
+		value &= ~PCF85063AT_CTRL2_FLAGS_MASK;
+	}
+	pSensorHandle->shadowReg[index] = value;
+	pSensorHandle->shadowValid |= (1U << index);
+}
+
+/*! Drop the shadow slots of every register touched by a register write list. */
+static void PCF85063AT_ShadowInvalidateList(PCF85063AT_sensorhandle_t *pSensorHandle, const registerwritelist_t *pRegWriteList)
+{
+	int32_t index;
+
+	for (; pRegWriteList->writeTo != 0xFFFF; pRegWriteList++)
+	{
+		index = PCF85063AT_ShadowIndex((uint8_t)pRegWriteList->writeTo);
+		if (index >= 0)
+		{
+			pSensorHandle->shadowValid &= ~(1U << index);
+		}
+	}
+}
+
+void PCF85063AT_InvalidateShadow(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	pSensorHandle->shadowValid = 0;
+}
+
+int32_t PCF85063AT_UpdateRegister(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t offset, uint8_t value, uint8_t mask)
+{
+	int32_t status;
+	int32_t index;
+	uint8_t regValue;
+	uint8_t writeValue;
+
+	index = PCF85063AT_ShadowIndex(offset);
+	if (index < 0)
+	{
+		/*! Not shadowed, let the register I/O layer do the read-modify-write. */
+		return Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+				offset, value, mask, repeatedStart);
+	}
+
+	if (mask)
+	{
+		/*! Fill the shadow once, every later masked update is a single write. */
+		if (!(pSensorHandle->shadowValid & (1U << index)))
+		{
+			status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+					offset, PCF85063AT_REG_SIZE_BYTE, &regValue);
+			if (ARM_DRIVER_OK != status)
+			{
+				return status;
+			}
+			PCF85063AT_ShadowStore(pSensorHandle, offset, regValue);
+		}
+		regValue = (pSensorHandle->shadowReg[index] & ~mask) | value;
+	}
+	else
+	{
+		regValue = value;
+	}
+
+	writeValue = regValue;
+	if ((index == PCF85063AT_SHADOW_CTRL2) && mask)
+	{
+		/*! Leave the flags which are not part of this update untouched on the device. */
+		writeValue |= (PCF85063AT_CTRL2_FLAGS_MASK & ~mask);
+	}
+
+	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			offset, writeValue, 0x00, repeatedStart);
+	if (ARM_DRIVER_OK != status)
+	{
+		pSensorHandle->shadowValid &= ~(1U << index);
+		return status;
+	}
+	PCF85063AT_ShadowStore(pSensorHandle, offset, regValue);
+
+	return ARM_DRIVER_OK;
+}
+
 int32_t PCF85063AT_Initialize(PCF85063AT_sensorhandle_t *pSensorHandle, ARM_DRIVER_I2C *pBus, uint8_t index, uint16_t sAddress)
 {
 	int32_t status;
@@ -55,10 +172,18 @@ int32_t PCF85063AT_Initialize(PCF85063AT_sensorhandle_t *pSensorHandle, ARM_DRIV
 	pSensorHandle->deviceInfo.deviceInstance = index;
 	pSensorHandle->deviceInfo.functionParam = NULL;
 	pSensorHandle->deviceInfo.idleFunction = NULL;
+	pSensorHandle->deviceInfo.timeoutUs = 0;
+	pSensorHandle->deviceInfo.waitMode = REGISTER_WAIT_YIELD;
+#if REGISTER_IO_STATS
+	Register_I2C_ResetStats(&pSensorHandle->deviceInfo);
+#endif
 
 	/*! Initialize the sensor handle. */
 	pSensorHandle->pCommDrv = pBus;
 	pSensorHandle->slaveAddress = sAddress;
+	pSensorHandle->shadowValid = 0;
+	pSensorHandle->asyncXfer.state = REGISTER_ASYNC_IDLE;
+	pSensorHandle->asyncCallback = NULL;
 	pSensorHandle->isInitialized = true;
 	return SENSOR_ERROR_NONE;
 }
@@ -71,6 +196,16 @@ void PCF85063AT_SetIdleTask(PCF85063AT_sensorhandle_t *pSensorHandle,
 	pSensorHandle->deviceInfo.idleFunction = idleTask;
 }
 
+void PCF85063AT_SetTimeout(PCF85063AT_sensorhandle_t *pSensorHandle, uint32_t timeoutUs)
+{
+	pSensorHandle->deviceInfo.timeoutUs = timeoutUs;
+}
+
+void PCF85063AT_SetWaitMode(PCF85063AT_sensorhandle_t *pSensorHandle, registerWaitMode_t waitMode)
+{
+	pSensorHandle->deviceInfo.waitMode = (uint8_t)waitMode;
+}
+
 
 int32_t PCF85063AT_ReadData(PCF85063AT_sensorhandle_t *pSensorHandle,
 		const registerreadlist_t *pReadList,
@@ -101,6 +236,28 @@ int32_t PCF85063AT_ReadData(PCF85063AT_sensorhandle_t *pSensorHandle,
 	return SENSOR_ERROR_NONE;
 }
 
+/*! Whether a read list reads size consecutive registers from first, the size of the frame it is read into. */
+static bool PCF85063AT_ReadListFits(const registerreadlist_t *pReadList, uint16_t first, uint32_t size)
+{
+	uint16_t next = first;
+
+	if (pReadList == NULL)
+	{
+		return false;
+	}
+
+	for (; pReadList->numBytes != 0; pReadList++)
+	{
+		if ((pReadList->readFrom != next) || ((uint32_t)(next - first) + pReadList->numBytes > size))
+		{
+			return false;
+		}
+		next += pReadList->numBytes;
+	}
+
+	return (uint32_t)(next - first) == size;
+}
+
 int32_t PCF85063AT_WriteData(PCF85063AT_sensorhandle_t *pSensorHandle, const registerwritelist_t *pRegWriteList)
 {
 	int32_t status;
@@ -118,6 +275,7 @@ int32_t PCF85063AT_WriteData(PCF85063AT_sensorhandle_t *pSensorHandle, const reg
 	}
 
 	/*! Apply the Sensor Configuration based on the Register Write List */
+	PCF85063AT_ShadowInvalidateList(pSensorHandle, pRegWriteList);
 	status = Sensor_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
 			pRegWriteList);
 	if (ARM_DRIVER_OK != status)
@@ -145,6 +303,7 @@ int32_t PCF85063AT_Configure(PCF85063AT_sensorhandle_t *pSensorHandle, const reg
 	}
 
 	/*! Apply the Sensor Configuration based on the Register Write List */
+	PCF85063AT_ShadowInvalidateList(pSensorHandle, pRegWriteList);
 	status = Sensor_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
 			pRegWriteList);
 	if (ARM_DRIVER_OK != status)
@@ -172,8 +331,8 @@ int32_t PCF85063AT_Rtc_Start(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Start RTC source clock */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,PCF85063AT_CTRL1,
-			(uint8_t)(rtcStart << PCF85063AT_CTRL1_START_STOP_SHIFT ),PCF85063AT_CTRL1_START_STOP_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,PCF85063AT_CTRL1,
+			(uint8_t)(rtcStart << PCF85063AT_CTRL1_START_STOP_SHIFT ),PCF85063AT_CTRL1_START_STOP_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -200,8 +359,8 @@ int32_t PCF85063AT_Rtc_Stop(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Stop RTC source clock */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL1,(uint8_t)(rtcStop << PCF85063AT_CTRL1_START_STOP_SHIFT ),PCF85063AT_CTRL1_START_STOP_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL1,(uint8_t)(rtcStop << PCF85063AT_CTRL1_START_STOP_SHIFT ),PCF85063AT_CTRL1_START_STOP_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -229,6 +388,9 @@ int32_t PCF85063AT_SwRst(PCF85063AT_sensorhandle_t *pSensorHandle)
 	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
 			PCF85063AT_CTRL1,(0x58),0x00,repeatedStart);
 
+	/*! The reset returns every register to its default, drop the shadow. */
+	PCF85063AT_InvalidateShadow(pSensorHandle);
+
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -239,10 +401,139 @@ int32_t PCF85063AT_SwRst(PCF85063AT_sensorhandle_t *pSensorHandle)
 
 /*! Set Time*/
 
+/*! Seconds to Years packed one register per byte, Seconds in the low byte. Per byte field masks and bounds,
+ *  the hours byte depends on the 12h/24h format. */
+#define PCF85063AT_FRAME_MASK_24H    (0x00FF1F073F3F7F7FULL)
+#define PCF85063AT_FRAME_MASK_12H    (0x00FF1F073F1F7F7FULL)
+#define PCF85063AT_FRAME_MIN_24H     (0x0000010001000000ULL)
+#define PCF85063AT_FRAME_MIN_12H     (0x0000010001010000ULL)
+#define PCF85063AT_FRAME_MAX_24H     (0x00630C061F173B3BULL)
+#define PCF85063AT_FRAME_MAX_12H     (0x00630C061F0C3B3BULL)
+#define PCF85063AT_FRAME_LOW_NIBBLES (0x0F0F0F0F0F0F0F0FULL)
+#define PCF85063AT_FRAME_HIGH_BITS   (0x8080808080808080ULL)
+
+/*! Whether every byte of frame lies within the bytes of min and max. Bytes below 0x80 only, so that the per
+ *  byte differences never borrow and their high bit tells the comparison. */
+static bool PCF85063AT_FrameInRange(uint64_t frame, uint64_t min, uint64_t max)
+{
+	if (frame & PCF85063AT_FRAME_HIGH_BITS)
+	{
+		return false;
+	}
+
+	return ((((max | PCF85063AT_FRAME_HIGH_BITS) - frame) & ((frame | PCF85063AT_FRAME_HIGH_BITS) - min) &
+			PCF85063AT_FRAME_HIGH_BITS) == PCF85063AT_FRAME_HIGH_BITS);
+}
+
+/*! Whether the day exists in the month, years 2000 to 2099 are leap when divisible by 4. */
+static bool PCF85063AT_DayInMonth(uint8_t days, uint8_t months, uint8_t years)
+{
+	uint32_t leap = ((years & 0x03) == 0) ? 1 : 0;
+
+	return days <= (s_cumulativeDays[leap][months] - s_cumulativeDays[leap][months - 1]);
+}
+
+int32_t PCF85063AT_TimeToBcd(const PCF85063AT_timedata_t *time, PCF85063AT_timeframe_t *raw)
+{
+	uint64_t frame, tens;
+	bool is12h;
+
+	/*! Validate for the correct time and frame variables.*/
+	if ((time == NULL) || (raw == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	is12h = (time->ampm == AM) || (time->ampm == PM);
+	frame = (uint64_t)time->second | ((uint64_t)time->minutes << 8) | ((uint64_t)time->hours << 16) |
+			((uint64_t)time->days << 24) | ((uint64_t)time->weekdays << 32) | ((uint64_t)time->months << 40) |
+			((uint64_t)time->years << 48);
+
+	if (!PCF85063AT_FrameInRange(frame, is12h ? PCF85063AT_FRAME_MIN_12H : PCF85063AT_FRAME_MIN_24H,
+			is12h ? PCF85063AT_FRAME_MAX_12H : PCF85063AT_FRAME_MAX_24H) ||
+			!PCF85063AT_DayInMonth(time->days, time->months, time->years))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! value / 10 as (value * 103) >> 10 in 16 bit lanes, even and odd bytes apart, then value + 6 * tens. */
+	tens = ((((frame & 0x00FF00FF00FF00FFULL) * 103) >> 10) & 0x000F000F000F000FULL) |
+			(((((frame >> 8) & 0x00FF00FF00FF00FFULL) * 103) >> 10) & 0x000F000F000F000FULL) << 8;
+	frame += tens * 6;
+
+	/*! Writing the Seconds register also clears the OS flag. */
+	raw->seconds = (uint8_t)frame;
+	raw->minutes = (uint8_t)(frame >> 8);
+	raw->hours = (uint8_t)(frame >> 16);
+	raw->days = (uint8_t)(frame >> 24);
+	raw->weekdays = (uint8_t)(frame >> 32);
+	raw->months = (uint8_t)(frame >> 40);
+	raw->years = (uint8_t)(frame >> 48);
+	if (time->ampm == PM)
+	{
+		raw->hours |= (PM << PCF85063AT_AM_PM_SHIFT);
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_BcdToTime(const PCF85063AT_timeframe_t *raw, Mode12h_24h mode12_24, PCF85063AT_timedata_t *time)
+{
+	uint64_t frame, high;
+	uint8_t hours;
+	bool valid;
+
+	/*! Validate for the correct frame and time variables.*/
+	if ((raw == NULL) || (time == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	hours = raw->hours;
+	frame = (uint64_t)raw->seconds | ((uint64_t)raw->minutes << 8) | ((uint64_t)hours << 16) |
+			((uint64_t)raw->days << 24) | ((uint64_t)raw->weekdays << 32) | ((uint64_t)raw->months << 40) |
+			((uint64_t)raw->years << 48);
+	frame &= (mode12_24 == mode24H) ? PCF85063AT_FRAME_MASK_24H : PCF85063AT_FRAME_MASK_12H;
+
+	/*! A nibble above 9 carries into bit 4 once 6 is added. */
+	high = (frame >> 4) & PCF85063AT_FRAME_LOW_NIBBLES;
+	valid = ((((frame & PCF85063AT_FRAME_LOW_NIBBLES) + 0x0606060606060606ULL) |
+			(high + 0x0606060606060606ULL)) & 0x1010101010101010ULL) == 0;
+
+	/*! tens * 10 + units is the BCD byte minus 6 * tens. */
+	frame -= high * 6;
+	valid = valid && PCF85063AT_FrameInRange(frame,
+			(mode12_24 == mode24H) ? PCF85063AT_FRAME_MIN_24H : PCF85063AT_FRAME_MIN_12H,
+			(mode12_24 == mode24H) ? PCF85063AT_FRAME_MAX_24H : PCF85063AT_FRAME_MAX_12H);
+
+	time->second = (uint8_t)frame;
+	time->minutes = (uint8_t)(frame >> 8);
+	time->hours = (uint8_t)(frame >> 16);
+	time->days = (uint8_t)(frame >> 24);
+	time->weekdays = (uint8_t)(frame >> 32);
+	time->months = (uint8_t)(frame >> 40);
+	time->years = (uint8_t)(frame >> 48);
+	if (mode12_24 == mode24H)
+	{
+		time->ampm = h24;
+	}
+	else   /* Set AM/PM */
+	{
+		time->ampm = ((hours >> PCF85063AT_AM_PM_SHIFT) & 0x01) ? PM : AM;
+	}
+
+	if (!valid || !PCF85063AT_DayInMonth(time->days, time->months, time->years))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
 int32_t PCF85063AT_SetTime(PCF85063AT_sensorhandle_t *pSensorHandle, PCF85063AT_timedata_t *time)
 {
 	int32_t status;
-	Mode12h_24h mode12_24;
+	PCF85063AT_timeframe_t frame;
 
 	/*! Validate for the correct handle and time read variable.*/
 	if ((pSensorHandle == NULL) || (time == NULL))
@@ -256,88 +547,205 @@ int32_t PCF85063AT_SetTime(PCF85063AT_sensorhandle_t *pSensorHandle, PCF85063AT_
 		return SENSOR_ERROR_INIT;
 	}
 
-	/*! Set Second.*/
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
-			PCF85063AT_SECOND , DecimaltoBcd(time->second & PCF85063AT_SECONDS_MASK) , PCF85063AT_SECONDS_MASK , repeatedStart);
-	if (ARM_DRIVER_OK != status)
+	/*! Every field is checked before the bus is touched. */
+	if (SENSOR_ERROR_NONE != PCF85063AT_TimeToBcd(time, &frame))
 	{
-		return SENSOR_ERROR_WRITE;
+		return SENSOR_ERROR_INVALID_PARAM;
 	}
 
-	/*! Set Minutes.*/
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_MINUTE, DecimaltoBcd(time->minutes & PCF85063AT_MINUTES_MASK ), PCF85063AT_MINUTES_MASK , repeatedStart);
+	/*! Set Seconds to Years in a single auto-incremented burst, so the clock can not
+	 *  tick between two fields. */
+	status = Register_I2C_BlockWrite(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			PCF85063AT_SECOND, (const uint8_t *)&frame, sizeof(frame));
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
 	}
 
-	/*! Update AM/PM Bit.*/
-	if(time->ampm == AM)
+	return SENSOR_ERROR_NONE;
+}
+
+
+/*! Get Time*/
+int32_t PCF85063AT_GetTime(PCF85063AT_sensorhandle_t *pSensorHandle, const registerreadlist_t *PCF85063ATtimedata, PCF85063AT_timedata_t *time )
+{
+	int32_t status;
+	Mode12h_24h mode12_24;
+	PCF85063AT_timeframe_t frame;
+
+	/*! Validate for the correct handle and time read variable.*/
+	if ((pSensorHandle == NULL) || (time == NULL))
 	{
-		time->hours = DecimaltoBcd(time->hours & PCF85063AT_HOURS_MASK_12H);
-		time->hours = ((time->hours) & (~(PM << PCF85063AT_AM_PM_SHIFT)));
+		return SENSOR_ERROR_INVALID_PARAM;
 	}
-	else if(time->ampm == PM)
+
+	/*! Check whether sensor handle is initialized before triggering sensor reset.*/
+	if (pSensorHandle->isInitialized != true)
 	{
-		time->hours = DecimaltoBcd(time->hours & PCF85063AT_HOURS_MASK_12H);
-		time->hours = (time->hours | (PM << PCF85063AT_AM_PM_SHIFT));
+		return SENSOR_ERROR_INIT;
 	}
-	else
-		time->hours = DecimaltoBcd(time->hours & PCF85063AT_HOURS_MASk_24H);
 
-	/*! Set Hour.*/
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_HOUR, time->hours , PCF85063AT_HOURS_MASk_24H, repeatedStart);
-	if (ARM_DRIVER_OK != status)
+	/*! The raw registers land in the frame, never in the caller's structure. */
+	if (!PCF85063AT_ReadListFits(PCF85063ATtimedata, PCF85063AT_SECOND, sizeof(frame)))
 	{
-		return SENSOR_ERROR_WRITE;
+		return SENSOR_ERROR_INVALID_PARAM;
 	}
 
-	/*! Set Day.*/
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_DAY, DecimaltoBcd(time->days & PCF85063AT_DAYS_MASK),PCF85063AT_DAYS_MASK, repeatedStart);
+	/*! Get time.*/
+	status = PCF85063AT_ReadData(pSensorHandle, PCF85063ATtimedata, (uint8_t *)&frame);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
 	}
 
-	/*! Set WeekDay.*/
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_WEEKDAY, DecimaltoBcd(time->weekdays &  PCF85063AT_WEEKDAYS_MASK ), PCF85063AT_WEEKDAYS_MASK, repeatedStart);
-	if (ARM_DRIVER_OK != status)
+	/*! after read convert BCD to Decimal */
+	PCF85063AT_12h_24h_Mode_Get(pSensorHandle, &mode12_24);
+	if (SENSOR_ERROR_NONE != PCF85063AT_BcdToTime(&frame, mode12_24, time))
 	{
-		return SENSOR_ERROR_WRITE;
+		return SENSOR_ERROR_READ;
 	}
 
-	/*! Set Months.*/
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_MONTH, DecimaltoBcd(time->months & PCF85063AT_MONTHS_MASK),PCF85063AT_MONTHS_MASK, repeatedStart);
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_GetTimeCoherent(PCF85063AT_sensorhandle_t *pSensorHandle, PCF85063AT_timedata_t *time, Mode12h_24h *pmode_12_24, bool *pOscStopped)
+{
+	int32_t status;
+	PCF85063AT_timeburst_t burst;
+	PCF85063AT_CTRL_1 Ctrl1_Reg;
+
+	/*! Validate for the correct handle and time read variable.*/
+	if ((pSensorHandle == NULL) || (time == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before triggering sensor reset.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	/*! Control_1 to Years in one burst, so mode and time come from the same snapshot. */
+	status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			PCF85063AT_CTRL1, sizeof(burst), (uint8_t *)&burst);
 	if (ARM_DRIVER_OK != status)
 	{
-		return SENSOR_ERROR_WRITE;
+		return SENSOR_ERROR_READ;
 	}
 
-	/*! Set Year.*/
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_YEAR, DecimaltoBcd(time->years & PCF85063AT_YEARS_MASK) , PCF85063AT_YEARS_MASK, repeatedStart);
+	/*! The control registers came along for free, refresh the shadow. */
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_CTRL1, burst.ctrl1);
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_CTRL2, burst.ctrl2);
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_OFFSET, burst.offset);
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_RAM_BYTE, burst.ramByte);
+
+	Ctrl1_Reg.w = burst.ctrl1;
+	status = PCF85063AT_BcdToTime(&burst.time, (Mode12h_24h)Ctrl1_Reg.b.mode_12_24, time);
+
+	if (pmode_12_24 != NULL)
+	{
+		*pmode_12_24 = (Mode12h_24h)Ctrl1_Reg.b.mode_12_24;
+	}
+	if (pOscStopped != NULL)
+	{
+		*pOscStopped = (burst.time.seconds & PCF85063AT_OS_MASK) ? true : false;
+	}
+
+	/*! A field out of range means a corrupted frame. */
+	return (SENSOR_ERROR_NONE == status) ? SENSOR_ERROR_NONE : SENSOR_ERROR_READ;
+}
+
+/*! Completion of PCF85063AT_GetTimeAsync(), runs in the I2C interrupt context. */
+static void PCF85063AT_GetTimeAsyncDone(void *pUserData, int32_t status)
+{
+	PCF85063AT_sensorhandle_t *pSensorHandle = (PCF85063AT_sensorhandle_t *)pUserData;
+	PCF85063AT_asynccallback_t callback = pSensorHandle->asyncCallback;
+	PCF85063AT_CTRL_1 Ctrl1_Reg;
+
+	if (ARM_DRIVER_OK == status)
+	{
+		PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_CTRL1, pSensorHandle->asyncBurst.ctrl1);
+		PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_CTRL2, pSensorHandle->asyncBurst.ctrl2);
+		PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_OFFSET, pSensorHandle->asyncBurst.offset);
+		PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_RAM_BYTE, pSensorHandle->asyncBurst.ramByte);
+
+		Ctrl1_Reg.w = pSensorHandle->asyncBurst.ctrl1;
+		if (SENSOR_ERROR_NONE != PCF85063AT_BcdToTime(&pSensorHandle->asyncBurst.time,
+				(Mode12h_24h)Ctrl1_Reg.b.mode_12_24, pSensorHandle->pAsyncTime))
+		{
+			status = ARM_DRIVER_ERROR;
+		}
+	}
+
+	pSensorHandle->asyncCallback = NULL;
+	if (callback)
+	{
+		callback(pSensorHandle->pAsyncUserData, (ARM_DRIVER_OK == status) ? SENSOR_ERROR_NONE : SENSOR_ERROR_READ);
+	}
+}
+
+int32_t PCF85063AT_GetTimeAsync(PCF85063AT_sensorhandle_t *pSensorHandle, PCF85063AT_timedata_t *time,
+		PCF85063AT_asynccallback_t callback, void *pUserData)
+{
+	int32_t status;
+
+	/*! Validate for the correct handle, time read variable and callback.*/
+	if ((pSensorHandle == NULL) || (time == NULL) || (callback == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before triggering sensor reset.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	/*! One asynchronous request per handle. */
+	if (pSensorHandle->asyncCallback != NULL)
+	{
+		return SENSOR_ERROR_BUSY;
+	}
+
+	pSensorHandle->pAsyncTime = time;
+	pSensorHandle->asyncCallback = callback;
+	pSensorHandle->pAsyncUserData = pUserData;
+
+	/*! Same burst as PCF85063AT_GetTimeCoherent(), the data phase is chained from the Signal Event Handler. */
+	status = Register_I2C_ReadAsync(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			PCF85063AT_CTRL1, sizeof(pSensorHandle->asyncBurst), (uint8_t *)&pSensorHandle->asyncBurst,
+			&pSensorHandle->asyncXfer, PCF85063AT_GetTimeAsyncDone, pSensorHandle);
 	if (ARM_DRIVER_OK != status)
 	{
-		return SENSOR_ERROR_WRITE;
+		pSensorHandle->asyncCallback = NULL;
+		return (ARM_DRIVER_ERROR_BUSY == status) ? SENSOR_ERROR_BUSY : SENSOR_ERROR_READ;
 	}
 
 	return SENSOR_ERROR_NONE;
 }
 
+/*! Completion of PCF85063AT_SetTimeAsync(), runs in the I2C interrupt context. */
+static void PCF85063AT_SetTimeAsyncDone(void *pUserData, int32_t status)
+{
+	PCF85063AT_sensorhandle_t *pSensorHandle = (PCF85063AT_sensorhandle_t *)pUserData;
+	PCF85063AT_asynccallback_t callback = pSensorHandle->asyncCallback;
 
-/*! Get Time*/
-int32_t PCF85063AT_GetTime(PCF85063AT_sensorhandle_t *pSensorHandle, const registerreadlist_t *PCF85063ATtimedata, PCF85063AT_timedata_t *time )
+	pSensorHandle->asyncCallback = NULL;
+	if (callback)
+	{
+		callback(pSensorHandle->pAsyncUserData, (ARM_DRIVER_OK == status) ? SENSOR_ERROR_NONE : SENSOR_ERROR_WRITE);
+	}
+}
+
+int32_t PCF85063AT_SetTimeAsync(PCF85063AT_sensorhandle_t *pSensorHandle, const PCF85063AT_timedata_t *time,
+		PCF85063AT_asynccallback_t callback, void *pUserData)
 {
 	int32_t status;
-	Mode12h_24h mode12_24;
+	PCF85063AT_timeframe_t frame;
 
-	/*! Validate for the correct handle and time read variable.*/
-	if ((pSensorHandle == NULL) || (time == NULL))
+	/*! Validate for the correct handle, time variable and callback.*/
+	if ((pSensorHandle == NULL) || (time == NULL) || (callback == NULL))
 	{
 		return SENSOR_ERROR_INVALID_PARAM;
 	}
@@ -348,39 +756,179 @@ int32_t PCF85063AT_GetTime(PCF85063AT_sensorhandle_t *pSensorHandle, const regis
 		return SENSOR_ERROR_INIT;
 	}
 
-	/*! Get time.*/
-	status = PCF85063AT_ReadData(pSensorHandle, PCF85063ATtimedata, ( uint8_t *)time );
+	/*! One asynchronous request per handle. */
+	if (pSensorHandle->asyncCallback != NULL)
+	{
+		return SENSOR_ERROR_BUSY;
+	}
+
+	/*! The encoded time is copied into the transfer descriptor, time can be reused once this returns. */
+	if (SENSOR_ERROR_NONE != PCF85063AT_TimeToBcd(time, &frame))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	pSensorHandle->asyncCallback = callback;
+	pSensorHandle->pAsyncUserData = pUserData;
+	status = Register_I2C_BlockWriteAsync(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			PCF85063AT_SECOND, (const uint8_t *)&frame, sizeof(frame),
+			&pSensorHandle->asyncXfer, PCF85063AT_SetTimeAsyncDone, pSensorHandle);
 	if (ARM_DRIVER_OK != status)
 	{
-		return SENSOR_ERROR_WRITE;
+		pSensorHandle->asyncCallback = NULL;
+		return (ARM_DRIVER_ERROR_BUSY == status) ? SENSOR_ERROR_BUSY : SENSOR_ERROR_WRITE;
 	}
 
-	/*! after read convert BCD to Decimal */
-	time->second = BcdToDecimal(time->second & PCF85063AT_SECONDS_MASK) ;
-	time->minutes = BcdToDecimal(time->minutes & PCF85063AT_MINUTES_MASK);
+	return SENSOR_ERROR_NONE;
+}
 
-	PCF85063AT_12h_24h_Mode_Get(pSensorHandle, &mode12_24);
-	if(mode12_24 ==  mode24H)
+int32_t PCF85063AT_TimeToEpoch(const PCF85063AT_timedata_t *time, uint32_t *pEpoch)
+{
+	uint32_t days;
+	uint32_t hours;
+	uint32_t leap;
+
+	if ((time == NULL) || (pEpoch == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+	if ((time->years > 99) || (time->months < 1) || (time->months > 12) || (time->days < 1) ||
+		!PCF85063AT_DayInMonth(time->days, time->months, time->years) || (time->minutes > 59) ||
+		(time->second > 59))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! 12h to 24h, 12 AM is midnight and 12 PM is noon. */
+	hours = time->hours;
+	if (time->ampm != h24)
+	{
+		if ((hours < 1) || (hours > 12))
+		{
+			return SENSOR_ERROR_INVALID_PARAM;
+		}
+		hours = (hours % 12) + ((time->ampm == PM) ? 12 : 0);
+	}
+	else if (hours > 23)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Every 4th year from 2000 is a leap year up to 2099, so no century rule is needed. */
+	leap = ((time->years & 0x03) == 0);
+	days = (365U * time->years) + ((time->years + 3U) >> 2) + s_cumulativeDays[leap][time->months - 1] + time->days - 1;
+
+	*pEpoch = PCF85063AT_EPOCH_2000 + (days * 86400U) + (hours * 3600U) + (time->minutes * 60U) + time->second;
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_EpochToTime(uint32_t epoch, Mode12h_24h mode12_24, PCF85063AT_timedata_t *time)
+{
+	uint32_t seconds;
+	uint32_t days;
+	uint32_t year;
+	uint32_t month;
+	uint32_t leap;
+
+	if ((time == NULL) || (epoch < PCF85063AT_EPOCH_2000) || (epoch >= PCF85063AT_EPOCH_2100))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	seconds = epoch - PCF85063AT_EPOCH_2000;
+	days = seconds / 86400U;
+	seconds -= days * 86400U;
+
+	/*! 2000-01-01 was a Saturday, weekday 0 is Sunday. */
+	time->weekdays = (uint8_t)((days + 6U) % 7U);
+
+	/*! 1461 days per 4 years, the first year of each group is the leap year. */
+	year = (days / 1461U) << 2;
+	days %= 1461U;
+	if (days >= 366U)
+	{
+		days -= 1U;
+		year += days / 365U;
+		days %= 365U;
+	}
+	leap = ((year & 0x03) == 0);
+
+	/*! The month is at most one above days / 32. */
+	month = days >> 5;
+	if (days >= s_cumulativeDays[leap][month + 1])
+	{
+		month++;
+	}
+
+	time->years = (uint8_t)year;
+	time->months = (uint8_t)(month + 1);
+	time->days = (uint8_t)(days - s_cumulativeDays[leap][month] + 1);
+	time->minutes = (uint8_t)((seconds % 3600U) / 60U);
+	time->second = (uint8_t)(seconds % 60U);
+	time->hours = (uint8_t)(seconds / 3600U);
+
+	if (mode12_24 == mode24H)
 	{
-		time->hours = BcdToDecimal(time->hours & PCF85063AT_HOURS_MASk_24H) ;
 		time->ampm = h24;
 	}
-	else   /* Set AM/PM */
+	else
 	{
-		if( (time->hours >> 5) & 0x01 )
-			time->ampm = PM;
-		else
-			time->ampm = AM;
-		time->hours =  BcdToDecimal(time->hours & PCF85063AT_HOURS_MASK_12H);
+		time->ampm = (time->hours >= 12) ? PM : AM;
+		time->hours = (time->hours % 12) ? (time->hours % 12) : 12;
 	}
-	time->days = BcdToDecimal(time->days & PCF85063AT_DAYS_MASK);
-	time->weekdays = BcdToDecimal(time->weekdays & PCF85063AT_WEEKDAYS_MASK);
-	time->months = BcdToDecimal(time->months & PCF85063AT_MONTHS_MASK);
-	time->years = BcdToDecimal(time->years) ;
 
 	return SENSOR_ERROR_NONE;
 }
 
+int32_t PCF85063AT_GetEpoch(PCF85063AT_sensorhandle_t *pSensorHandle, uint32_t *pEpoch)
+{
+	int32_t status;
+	PCF85063AT_timedata_t time;
+
+	/*! Validate for the correct handle and epoch read variable.*/
+	if ((pSensorHandle == NULL) || (pEpoch == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	status = PCF85063AT_GetTimeCoherent(pSensorHandle, &time, NULL, NULL);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	return PCF85063AT_TimeToEpoch(&time, pEpoch);
+}
+
+int32_t PCF85063AT_SetEpoch(PCF85063AT_sensorhandle_t *pSensorHandle, uint32_t epoch)
+{
+	int32_t status;
+	Mode12h_24h mode12_24;
+	PCF85063AT_timedata_t time;
+
+	/*! Validate for the correct handle.*/
+	if (pSensorHandle == NULL)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Encode the hours in the mode the RTC runs in. */
+	status = PCF85063AT_12h_24h_Mode_Get(pSensorHandle, &mode12_24);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	status = PCF85063AT_EpochToTime(epoch, mode12_24, &time);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	return PCF85063AT_SetTime(pSensorHandle, &time);
+}
+
 int32_t PCF85063AT_12h_24h_Mode_Set(PCF85063AT_sensorhandle_t *pSensorHandle, Mode12h_24h is_mode12h)
 {
 	int32_t status;
@@ -398,8 +946,8 @@ int32_t PCF85063AT_12h_24h_Mode_Set(PCF85063AT_sensorhandle_t *pSensorHandle, Mo
 	}
 
 	/*! Set 12/24 mode */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL1, (uint8_t)(((is_mode12h == mode12H) ? mode12H : mode24H )<< PCF85063AT_CTRL1_12_HOUR_24_HOUR_MODE_SHIFT ), PCF85063AT_CTRL1_12_HOUR_24_HOUR_MODE_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL1, (uint8_t)(((is_mode12h == mode12H) ? mode12H : mode24H )<< PCF85063AT_CTRL1_12_HOUR_24_HOUR_MODE_SHIFT ), PCF85063AT_CTRL1_12_HOUR_24_HOUR_MODE_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -425,12 +973,20 @@ int32_t PCF85063AT_12h_24h_Mode_Get(PCF85063AT_sensorhandle_t *pSensorHandle, Mo
 		return SENSOR_ERROR_INIT;
 	}
 
-	/*! Get 12/24 mode */
-	status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL1, PCF85063AT_REG_SIZE_BYTE, (uint8_t *)&Ctrl1_Reg);
-	if (ARM_DRIVER_OK != status)
+	/*! Get 12/24 mode, from the shadow when it is valid */
+	if (pSensorHandle->shadowValid & (1U << PCF85063AT_SHADOW_CTRL1))
 	{
-		return SENSOR_ERROR_READ;
+		Ctrl1_Reg.w = pSensorHandle->shadowReg[PCF85063AT_SHADOW_CTRL1];
+	}
+	else
+	{
+		status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+				PCF85063AT_CTRL1, PCF85063AT_REG_SIZE_BYTE, (uint8_t *)&Ctrl1_Reg);
+		if (ARM_DRIVER_OK != status)
+		{
+			return SENSOR_ERROR_READ;
+		}
+		PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_CTRL1, Ctrl1_Reg.w);
 	}
 	*pmode_12_24 = Ctrl1_Reg.b.mode_12_24;
 
@@ -454,8 +1010,8 @@ int32_t PCF85063AT_capSel_7(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! select 7pF capacitor frequency*/
-		status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-				PCF85063AT_CTRL1,(uint8_t)(capSel7pf << PCF85063AT_CTRL1_CAP_SEL_SHIFT ),PCF85063AT_CTRL1_CAP_SEL_MASK,repeatedStart);
+		status = PCF85063AT_UpdateRegister(pSensorHandle,
+				PCF85063AT_CTRL1,(uint8_t)(capSel7pf << PCF85063AT_CTRL1_CAP_SEL_SHIFT ),PCF85063AT_CTRL1_CAP_SEL_MASK);
 
 	if (ARM_DRIVER_OK != status)
 	{
@@ -482,8 +1038,8 @@ int32_t PCF85063AT_capSel_12(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! select 12.5pF capacitor frequency*/
-		status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-				PCF85063AT_CTRL1,(uint8_t)(capSel12pf << PCF85063AT_CTRL1_CAP_SEL_SHIFT ),PCF85063AT_CTRL1_CAP_SEL_MASK,repeatedStart);
+		status = PCF85063AT_UpdateRegister(pSensorHandle,
+				PCF85063AT_CTRL1,(uint8_t)(capSel12pf << PCF85063AT_CTRL1_CAP_SEL_SHIFT ),PCF85063AT_CTRL1_CAP_SEL_MASK);
 
 	if (ARM_DRIVER_OK != status)
 	{
@@ -510,8 +1066,8 @@ int32_t PCF85063AT_normalMode(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Set normal mode*/
-		status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-				PCF85063AT_CTRL1,(uint8_t)(normalMode << PCF85063AT_CTRL1_EXT_TEST_SHIFT ),PCF85063AT_CTRL1_EXT_TEST_MASK,repeatedStart);
+		status = PCF85063AT_UpdateRegister(pSensorHandle,
+				PCF85063AT_CTRL1,(uint8_t)(normalMode << PCF85063AT_CTRL1_EXT_TEST_SHIFT ),PCF85063AT_CTRL1_EXT_TEST_MASK);
 
 	if (ARM_DRIVER_OK != status)
 	{
@@ -538,8 +1094,8 @@ int32_t PCF85063AT_ExtTestMode(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! set external test mode*/
-		status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-				PCF85063AT_CTRL1,(uint8_t)(extTestMode << PCF85063AT_CTRL1_EXT_TEST_SHIFT ),PCF85063AT_CTRL1_EXT_TEST_MASK,repeatedStart);
+		status = PCF85063AT_UpdateRegister(pSensorHandle,
+				PCF85063AT_CTRL1,(uint8_t)(extTestMode << PCF85063AT_CTRL1_EXT_TEST_SHIFT ),PCF85063AT_CTRL1_EXT_TEST_MASK);
 
 	if (ARM_DRIVER_OK != status)
 	{
@@ -574,6 +1130,8 @@ int32_t PCF85063AT_Check_MinHalfMinCTInt(PCF85063AT_sensorhandle_t *pSensorHandl
 	{
 		return SENSOR_ERROR_READ;
 	}
+	/*! The flags are volatile, only the control bits are cached. */
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_CTRL2, Ctrl2_Reg.w);
     *pIntStatus = Ctrl2_Reg.b.tf ;
 	return SENSOR_ERROR_NONE;
 }
@@ -595,8 +1153,8 @@ int32_t PCF85063AT_Clear_MinHalfMinCTInt(PCF85063AT_sensorhandle_t *pSensorHandl
 	}
 
 	/*! clear Minute/half minute/countdown timer interrupt flag */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL2, (uint8_t)(intClear << PCF85063AT_CTRL2_TF_SHIFT), PCF85063AT_CTRL2_TF_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL2, (uint8_t)(intClear << PCF85063AT_CTRL2_TF_SHIFT), PCF85063AT_CTRL2_TF_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -622,13 +1180,14 @@ int32_t PCF85063AT_MinInt_Enable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Minute Interrupt Enable */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL2, (uint8_t)(intEnable << PCF85063AT_CTRL2_MI_SHIFT ), PCF85063AT_CTRL2_MI_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL2, (uint8_t)(intEnable << PCF85063AT_CTRL2_MI_SHIFT ), PCF85063AT_CTRL2_MI_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
 	}
 
+	return SENSOR_ERROR_NONE;
 }
 
 int32_t PCF85063AT_MinInt_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
@@ -648,8 +1207,8 @@ int32_t PCF85063AT_MinInt_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Minute Interrupt Disable */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL2,(uint8_t)(intDisable << PCF85063AT_CTRL2_MI_SHIFT ), PCF85063AT_CTRL2_MI_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL2,(uint8_t)(intDisable << PCF85063AT_CTRL2_MI_SHIFT ), PCF85063AT_CTRL2_MI_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -675,12 +1234,14 @@ int32_t PCF85063AT_HalfMinInt_Enable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Half Minute Interrupt Enable */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL2, (uint8_t)(intEnable << PCF85063AT_CTRL2_HMI_SHIFT ), PCF85063AT_CTRL2_HMI_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL2, (uint8_t)(intEnable << PCF85063AT_CTRL2_HMI_SHIFT ), PCF85063AT_CTRL2_HMI_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
 	}
+
+	return SENSOR_ERROR_NONE;
 }
 
 int32_t PCF85063AT_HalfMinInt_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
@@ -700,8 +1261,8 @@ int32_t PCF85063AT_HalfMinInt_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Half Minute Interrupt Disable */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL2,(uint8_t)(intDisable << PCF85063AT_CTRL2_HMI_SHIFT ), PCF85063AT_CTRL2_HMI_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL2,(uint8_t)(intDisable << PCF85063AT_CTRL2_HMI_SHIFT ), PCF85063AT_CTRL2_HMI_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -711,6 +1272,124 @@ int32_t PCF85063AT_HalfMinInt_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
 }
 
 
+int32_t PCF85063AT_Get_Ctrl2(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t *pCtrl2)
+{
+	int32_t status;
+
+	/*! Validate for the correct handle and Control_2 read variable.*/
+	if ((pSensorHandle == NULL) || (pCtrl2 == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before triggering sensor reset.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	/*! Flags and interrupt enables in one read */
+	status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			PCF85063AT_CTRL2, PCF85063AT_REG_SIZE_BYTE, pCtrl2);
+	if (ARM_DRIVER_OK != status)
+	{
+		return SENSOR_ERROR_READ;
+	}
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_CTRL2, *pCtrl2);
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Get_TimerMode(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t *pTimerMode)
+{
+	int32_t status;
+
+	/*! Validate for the correct handle and Timer_mode read variable.*/
+	if ((pSensorHandle == NULL) || (pTimerMode == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before reading the register.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	if (pSensorHandle->shadowValid & (1U << PCF85063AT_SHADOW_TIMER_MODE))
+	{
+		*pTimerMode = pSensorHandle->shadowReg[PCF85063AT_SHADOW_TIMER_MODE];
+		return SENSOR_ERROR_NONE;
+	}
+
+	status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			PCF85063AT_TIMER_MODE, PCF85063AT_REG_SIZE_BYTE, pTimerMode);
+	if (ARM_DRIVER_OK != status)
+	{
+		return SENSOR_ERROR_READ;
+	}
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_TIMER_MODE, *pTimerMode);
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Get_TimerValue(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t *pTimerValue)
+{
+	int32_t status;
+
+	/*! Validate for the correct handle and Timer_value read variable.*/
+	if ((pSensorHandle == NULL) || (pTimerValue == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before reading the register.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			PCF85063AT_TIMER_VALUE, PCF85063AT_REG_SIZE_BYTE, pTimerValue);
+	if (ARM_DRIVER_OK != status)
+	{
+		return SENSOR_ERROR_READ;
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Clear_Flags(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t flags)
+{
+	int32_t status;
+
+	/*! Validate for the correct handle and flags.*/
+	if ((pSensorHandle == NULL) || (flags & ~PCF85063AT_CTRL2_FLAGS_MASK))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before triggering sensor reset.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	if (flags == 0)
+	{
+		return SENSOR_ERROR_NONE;
+	}
+
+	/*! Clear the selected flags in one write, the others are written as 1 and left untouched. */
+	status = PCF85063AT_UpdateRegister(pSensorHandle, PCF85063AT_CTRL2, 0x00, flags);
+	if (ARM_DRIVER_OK != status)
+	{
+		return SENSOR_ERROR_WRITE;
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
 int32_t PCF85063AT_Clear_AlarmInt(PCF85063AT_sensorhandle_t *pSensorHandle)
 {
 	int32_t status;
@@ -728,8 +1407,8 @@ int32_t PCF85063AT_Clear_AlarmInt(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Clear Alarm flag */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL2, (uint8_t)(intClear << PCF85063AT_CTRL2_AF_SHIFT), PCF85063AT_CTRL2_AF_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL2, (uint8_t)(intClear << PCF85063AT_CTRL2_AF_SHIFT), PCF85063AT_CTRL2_AF_MASK);
 
 	if (ARM_DRIVER_OK != status)
 	{
@@ -764,6 +1443,8 @@ int32_t PCF85063AT_Check_AlarmInt(PCF85063AT_sensorhandle_t *pSensorHandle, IntS
 	{
 		return SENSOR_ERROR_READ;
 	}
+	/*! The flags are volatile, only the control bits are cached. */
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_CTRL2, Ctrl2_Reg.w);
 
 	*pAlarmState = Ctrl2_Reg.b.af ;
 
@@ -787,8 +1468,8 @@ int32_t PCF85063AT_AlarmInt_Enable(PCF85063AT_sensorhandle_t *pSensorHandle, Ala
 	}
 
 	/*! Enable Alarm */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL2, (uint8_t)(intEnable << PCF85063AT_CTRL2_AIE_SHIFT), PCF85063AT_CTRL2_AIE_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL2, (uint8_t)(intEnable << PCF85063AT_CTRL2_AIE_SHIFT), PCF85063AT_CTRL2_AIE_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -838,6 +1519,7 @@ int32_t PCF85063AT_AlarmInt_Enable(PCF85063AT_sensorhandle_t *pSensorHandle, Ala
 		}
 	}
 
+	return SENSOR_ERROR_NONE;
 }
 
 int32_t PCF85063AT_AlarmInt_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
@@ -855,14 +1537,98 @@ int32_t PCF85063AT_AlarmInt_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	{
 		return SENSOR_ERROR_INIT;
 	}
-
-	/*! Disable Alarm */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL2, (uint8_t)(intDisable << PCF85063AT_CTRL2_AIE_SHIFT), PCF85063AT_CTRL2_AIE_MASK,repeatedStart);
-	if (ARM_DRIVER_OK != status)
+
+	/*! Disable Alarm */
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL2, (uint8_t)(intDisable << PCF85063AT_CTRL2_AIE_SHIFT), PCF85063AT_CTRL2_AIE_MASK);
+	if (ARM_DRIVER_OK != status)
+	{
+		return SENSOR_ERROR_WRITE;
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_AlarmToBcd(const PCF85063AT_alarmdata_t *alarmtime, AlarmType alarmtype,
+		PCF85063AT_alarmframe_t *raw)
+{
+	bool is12h;
+
+	/*! Validate for the correct alarm time, type and frame variables.*/
+	if ((alarmtime == NULL) || (raw == NULL) || (alarmtype < A_Seconds) || (alarmtype > A_Weekday))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	is12h = (alarmtime->ampm == AM) || (alarmtime->ampm == PM);
+	if ((alarmtime->second > 59) || (alarmtime->minutes > 59) || (alarmtime->days < 1) || (alarmtime->days > 31) ||
+			(alarmtime->weekdays > 6) || (is12h && ((alarmtime->hours < 1) || (alarmtime->hours > 12))) ||
+			(!is12h && (alarmtime->hours > 23)))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	raw->second = DecimaltoBcd(alarmtime->second);
+	raw->minute = DecimaltoBcd(alarmtime->minutes);
+	raw->hour = DecimaltoBcd(alarmtime->hours);
+	if (alarmtime->ampm == PM)
+	{
+		raw->hour |= (PM << PCF85063AT_AM_PM_SHIFT);
+	}
+	raw->day = DecimaltoBcd(alarmtime->days);
+	raw->weekday = DecimaltoBcd(alarmtime->weekdays);
+
+	/*! AEN_x set disables the field, from seconds up to the first enabled one. */
+	switch (alarmtype)
+	{
+	case A_Weekday:
+		raw->day |= PCF85063AT_AEN_D_MASK;
+		/* fall through */
+	case A_Day:
+		raw->hour |= PCF85063AT_AEN_H_MASK;
+		/* fall through */
+	case A_Hour:
+		raw->minute |= PCF85063AT_AEN_M_MASK;
+		/* fall through */
+	case A_Minute:
+		raw->second |= PCF85063AT_AEN_S_MASK;
+		break;
+	default:
+		break;
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_BcdToAlarm(const PCF85063AT_alarmframe_t *raw, Mode12h_24h mode12_24,
+		PCF85063AT_alarmdata_t *alarmtime)
+{
+	uint8_t hours;
+
+	/*! Validate for the correct frame and alarm time variables.*/
+	if ((raw == NULL) || (alarmtime == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	hours = raw->hour;
+	alarmtime->second = BcdToDecimal(raw->second & PCF85063AT_SECONDS_ALARM_MASK) ;
+	alarmtime->minutes = BcdToDecimal(raw->minute & PCF85063AT_MINUTES_ALARM_MASK) ;
+	if(mode12_24 ==  mode24H)
+	{
+		alarmtime->hours = BcdToDecimal(hours & PCF85063AT_HOURS_ALARM_MASK_24H) ;
+		alarmtime->ampm = h24;
+	}
+	else   /* Set AM/PM */
 	{
-		return SENSOR_ERROR_WRITE;
+		if( (hours >> PCF85063AT_AM_PM_SHIFT) & 0x01 )
+			alarmtime->ampm = PM;
+		else
+			alarmtime->ampm = AM;
+		alarmtime->hours =  BcdToDecimal(hours & PCF85063AT_HOURS_ALARM_MASK_12H);
 	}
+	alarmtime->days = BcdToDecimal(raw->day & PCF85063AT_DAYS_ALARM_MASK);
+	alarmtime->weekdays = BcdToDecimal(raw->weekday & PCF85063AT_WEEKDAYS_ALARM_MASK);
 
 	return SENSOR_ERROR_NONE;
 }
@@ -871,6 +1637,7 @@ int32_t PCF85063AT_GetAlarmTime(PCF85063AT_sensorhandle_t *pSensorHandle, const
 {
 	int32_t status;
 	Mode12h_24h mode12_24;
+	PCF85063AT_alarmframe_t frame;
 
 	/*! Validate for the correct handle and Alarm read variable.*/
 	if ((pSensorHandle == NULL) || (alarmtime == NULL))
@@ -884,34 +1651,23 @@ int32_t PCF85063AT_GetAlarmTime(PCF85063AT_sensorhandle_t *pSensorHandle, const
 		return SENSOR_ERROR_INIT;
 	}
 
+	/*! The raw registers land in the frame, never in the caller's structure. */
+	if (!PCF85063AT_ReadListFits(PCF85063ATalarmdata, PCF85063AT_SECOND_ALARM, sizeof(frame)))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
 	/*! Get Alarm time.*/
-	status = PCF85063AT_ReadData(pSensorHandle, PCF85063ATalarmdata, ( uint8_t *)alarmtime);
+	status = PCF85063AT_ReadData(pSensorHandle, PCF85063ATalarmdata, (uint8_t *)&frame);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
 	}
 
 	/*! after read convert BCD to Decimal */
-	alarmtime->second = BcdToDecimal(alarmtime->second & PCF85063AT_SECONDS_ALARM_MASK) ;
-	alarmtime->minutes = BcdToDecimal(alarmtime->minutes & PCF85063AT_MINUTES_ALARM_MASK) ;
 	PCF85063AT_12h_24h_Mode_Get(pSensorHandle, &mode12_24);
-	if(mode12_24 ==  mode24H)
-	{
-		alarmtime->hours = BcdToDecimal(alarmtime->hours & PCF85063AT_HOURS_ALARM_MASK_24H) ;
-		alarmtime->ampm = h24;
-	}
-	else   /* Set AM/PM */
-	{
-		if( (alarmtime->hours >> 5) & 0x01 )
-			alarmtime->ampm = PM;
-		else
-			alarmtime->ampm = AM;
-		alarmtime->hours =  BcdToDecimal(alarmtime->hours & PCF85063AT_HOURS_ALARM_MASK_12H);
-	}
-	alarmtime->days = BcdToDecimal(alarmtime->days & PCF85063AT_DAYS_ALARM_MASK);
-	alarmtime->weekdays = BcdToDecimal(alarmtime->weekdays & PCF85063AT_WEEKDAYS_ALARM_MASK);
 
-	return SENSOR_ERROR_NONE;
+	return PCF85063AT_BcdToAlarm(&frame, mode12_24, alarmtime);
 }
 
 
@@ -989,6 +1745,33 @@ int32_t PCF85063AT_SetAlarmTime(PCF85063AT_sensorhandle_t *pSensorHandle, PCF850
 	return SENSOR_ERROR_NONE;
 }
 
+int32_t PCF85063AT_SetAlarmFrame(PCF85063AT_sensorhandle_t *pSensorHandle, const PCF85063AT_alarmframe_t *raw)
+{
+	int32_t status;
+
+	/*! Validate for the correct handle and frame.*/
+	if ((pSensorHandle == NULL) || (raw == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before writing the alarm.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	/*! Second_alarm to Weekday_alarm in one burst. */
+	status = Register_I2C_BlockWrite(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			PCF85063AT_SECOND_ALARM, (const uint8_t *)raw, sizeof(PCF85063AT_alarmframe_t));
+	if (ARM_DRIVER_OK != status)
+	{
+		return SENSOR_ERROR_WRITE;
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
 int32_t PCF85063AT_TimerInt_Enable(PCF85063AT_sensorhandle_t *pSensorHandle)
 {
 	int32_t status;
@@ -1006,12 +1789,14 @@ int32_t PCF85063AT_TimerInt_Enable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Timer Interrupt Enable */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE, (uint8_t)(intEnable << PCF85063AT_SECONDS_TIE_SHIFT ), PCF85063AT_SECONDS_TIE_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_TIMER_MODE, (uint8_t)(intEnable << PCF85063AT_SECONDS_TIE_SHIFT ), PCF85063AT_SECONDS_TIE_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
 	}
+
+	return SENSOR_ERROR_NONE;
 }
 
 int32_t PCF85063AT_TimerInt_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
@@ -1031,8 +1816,8 @@ int32_t PCF85063AT_TimerInt_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Timer Interrupt Disable */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE,(uint8_t)(intDisable << PCF85063AT_SECONDS_TIE_SHIFT ), PCF85063AT_SECONDS_TIE_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_TIMER_MODE,(uint8_t)(intDisable << PCF85063AT_SECONDS_TIE_SHIFT ), PCF85063AT_SECONDS_TIE_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -1058,13 +1843,21 @@ int32_t PCF85063AT_Check_TI_TP(PCF85063AT_sensorhandle_t *pSensorHandle, TI_TP_S
 		return SENSOR_ERROR_INIT;
 	}
 
-	/*! Check Timer Interrupt Mode */
-	status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE, PCF85063AT_REG_SIZE_BYTE, (uint8_t *)&TimerMode_Reg);
-
-	if (ARM_DRIVER_OK != status)
+	/*! Check Timer Interrupt Mode, from the shadow when it is valid */
+	if (pSensorHandle->shadowValid & (1U << PCF85063AT_SHADOW_TIMER_MODE))
 	{
-		return SENSOR_ERROR_READ;
+		TimerMode_Reg.w = pSensorHandle->shadowReg[PCF85063AT_SHADOW_TIMER_MODE];
+	}
+	else
+	{
+		status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+				PCF85063AT_TIMER_MODE, PCF85063AT_REG_SIZE_BYTE, (uint8_t *)&TimerMode_Reg);
+
+		if (ARM_DRIVER_OK != status)
+		{
+			return SENSOR_ERROR_READ;
+		}
+		PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_TIMER_MODE, TimerMode_Reg.w);
 	}
 	*pTI_TPState = TimerMode_Reg.b.ti_tp ;
 
@@ -1088,12 +1881,14 @@ int32_t PCF85063AT_TI_TP_Enable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Timer Interrupt mode Enable */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE, (uint8_t)( pulse << PCF85063AT_SECONDS_TI_TP_SHIFT ), PCF85063AT_SECONDS_TI_TP_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_TIMER_MODE, (uint8_t)( pulse << PCF85063AT_SECONDS_TI_TP_SHIFT ), PCF85063AT_SECONDS_TI_TP_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
 	}
+
+	return SENSOR_ERROR_NONE;
 }
 
 int32_t PCF85063AT_TI_TP_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
@@ -1113,8 +1908,8 @@ int32_t PCF85063AT_TI_TP_Disable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Timer Interrupt mode Disable */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE,(uint8_t)(timer_flag << PCF85063AT_SECONDS_TI_TP_SHIFT ), PCF85063AT_SECONDS_TI_TP_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_TIMER_MODE,(uint8_t)(timer_flag << PCF85063AT_SECONDS_TI_TP_SHIFT ), PCF85063AT_SECONDS_TI_TP_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -1140,8 +1935,8 @@ int32_t PCF85063AT_TestFreeRAMByte(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*!Free RAM Byte */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_RAM_BYTE,0x3c,0x00,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_RAM_BYTE,0x3c,0x00);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -1167,8 +1962,8 @@ int32_t PCF85063AT_Normal_OffsetMode(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Normal offset mode */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_OFFSET,(uint8_t)(normal_mode << PCF85063AT_OFFSET_MODE_SHIFT),PCF85063AT_OFFSET_MODE_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_OFFSET,(uint8_t)(normal_mode << PCF85063AT_OFFSET_MODE_SHIFT),PCF85063AT_OFFSET_MODE_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -1194,8 +1989,8 @@ int32_t PCF85063AT_Course_OffsetMode(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Course offset mode */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_OFFSET,(course_mode << PCF85063AT_OFFSET_MODE_SHIFT),PCF85063AT_OFFSET_MODE_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_OFFSET,(course_mode << PCF85063AT_OFFSET_MODE_SHIFT),PCF85063AT_OFFSET_MODE_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -1221,8 +2016,8 @@ int32_t PCF85063AT_CI_enable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Correction Interrupt enable */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL1,(intEnable << PCF85063AT_CTRL1_CIE_SHIFT),PCF85063AT_CTRL1_CIE_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL1,(intEnable << PCF85063AT_CTRL1_CIE_SHIFT),PCF85063AT_CTRL1_CIE_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -1248,8 +2043,8 @@ int32_t PCF85063AT_CI_disable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Correction Interrupt Disable */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_CTRL1,(intDisable << PCF85063AT_CTRL1_CIE_SHIFT),PCF85063AT_CTRL1_CIE_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_CTRL1,(intDisable << PCF85063AT_CTRL1_CIE_SHIFT),PCF85063AT_CTRL1_CIE_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -1275,8 +2070,8 @@ int32_t PCF85063AT_timer_enable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Timer enabled */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE,(intEnable << PCF85063AT_SECONDS_TE_SHIFT),PCF85063AT_SECONDS_TE_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_TIMER_MODE,(intEnable << PCF85063AT_SECONDS_TE_SHIFT),PCF85063AT_SECONDS_TE_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -1302,8 +2097,8 @@ int32_t PCF85063AT_timer_disable(PCF85063AT_sensorhandle_t *pSensorHandle)
 	}
 
 	/*! Timer Disabled */
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE,(intDisable << PCF85063AT_SECONDS_TE_SHIFT),PCF85063AT_SECONDS_TE_MASK,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_TIMER_MODE,(intDisable << PCF85063AT_SECONDS_TE_SHIFT),PCF85063AT_SECONDS_TE_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -1331,8 +2126,8 @@ int32_t PCF85063AT_SetTimerClockFreq(PCF85063AT_sensorhandle_t *pSensorHandle, i
 	switch (tcf)
 	{
 	case 1: /*4.096 kHz timer source clock*/
-		status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE,(timer1 << PCF85063AT_SECONDS_TCF_SHIFT),PCF85063AT_SECONDS_TCF_MASK,repeatedStart);
+		status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_TIMER_MODE,(timer1 << PCF85063AT_SECONDS_TCF_SHIFT),PCF85063AT_SECONDS_TCF_MASK);
 		if (ARM_DRIVER_OK != status)
 		{
 			return SENSOR_ERROR_WRITE;
@@ -1341,8 +2136,8 @@ int32_t PCF85063AT_SetTimerClockFreq(PCF85063AT_sensorhandle_t *pSensorHandle, i
 
 
 	case 2: /*64 Hz timer source clock*/
-		status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE,(timer2 << PCF85063AT_SECONDS_TCF_SHIFT),PCF85063AT_SECONDS_TCF_MASK,repeatedStart);
+		status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_TIMER_MODE,(timer2 << PCF85063AT_SECONDS_TCF_SHIFT),PCF85063AT_SECONDS_TCF_MASK);
 		if (ARM_DRIVER_OK != status)
 		{
 			return SENSOR_ERROR_WRITE;
@@ -1350,8 +2145,8 @@ int32_t PCF85063AT_SetTimerClockFreq(PCF85063AT_sensorhandle_t *pSensorHandle, i
 		return SENSOR_ERROR_NONE;
 
 	case 3: /*1 Hz timer source clock*/
-		status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE,(timer3 << PCF85063AT_SECONDS_TCF_SHIFT),PCF85063AT_SECONDS_TCF_MASK,repeatedStart);
+		status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_TIMER_MODE,(timer3 << PCF85063AT_SECONDS_TCF_SHIFT),PCF85063AT_SECONDS_TCF_MASK);
 		if (ARM_DRIVER_OK != status)
 		{
 			return SENSOR_ERROR_WRITE;
@@ -1360,8 +2155,8 @@ int32_t PCF85063AT_SetTimerClockFreq(PCF85063AT_sensorhandle_t *pSensorHandle, i
 
 
 	case 4: /*1⁄60 Hz timer source clock*/
-		status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_TIMER_MODE,(timer4 << PCF85063AT_SECONDS_TCF_SHIFT),PCF85063AT_SECONDS_TCF_MASK,repeatedStart);
+		status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_TIMER_MODE,(timer4 << PCF85063AT_SECONDS_TCF_SHIFT),PCF85063AT_SECONDS_TCF_MASK);
 		if (ARM_DRIVER_OK != status)
 		{
 			return SENSOR_ERROR_WRITE;
@@ -1369,6 +2164,7 @@ int32_t PCF85063AT_SetTimerClockFreq(PCF85063AT_sensorhandle_t *pSensorHandle, i
 		return SENSOR_ERROR_NONE;
 	}
 
+	return SENSOR_ERROR_INVALID_PARAM;
 }
 
 int32_t PCF85063AT_Countdown_timer_value(PCF85063AT_sensorhandle_t *pSensorHandle, int32_t CT_value)
@@ -1397,6 +2193,165 @@ int32_t PCF85063AT_Countdown_timer_value(PCF85063AT_sensorhandle_t *pSensorHandl
 	return SENSOR_ERROR_NONE;
 }
 
+/*! Load Timer_value and Timer_mode in one burst, the Timer_mode bits in keep are taken from the device. */
+static int32_t PCF85063AT_TimerLoad(PCF85063AT_sensorhandle_t *pSensorHandle, TCF tcf, uint8_t value, uint8_t keep,
+		uint8_t set)
+{
+	int32_t status;
+	uint8_t mode;
+	PCF85063AT_timerframe_t frame;
+
+	/*! Timer_mode from the shadow, read once when it is not valid. */
+	if (!(pSensorHandle->shadowValid & (1U << PCF85063AT_SHADOW_TIMER_MODE)))
+	{
+		status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+				PCF85063AT_TIMER_MODE, PCF85063AT_REG_SIZE_BYTE, &mode);
+		if (ARM_DRIVER_OK != status)
+		{
+			return SENSOR_ERROR_READ;
+		}
+		PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_TIMER_MODE, mode);
+	}
+	mode = pSensorHandle->shadowReg[PCF85063AT_SHADOW_TIMER_MODE];
+
+	/*! A value written while the timer runs may corrupt the first period, stop it first. */
+	if (mode & PCF85063AT_SECONDS_TE_MASK)
+	{
+		status = PCF85063AT_UpdateRegister(pSensorHandle,
+				PCF85063AT_TIMER_MODE, (uint8_t)(intDisable << PCF85063AT_SECONDS_TE_SHIFT), PCF85063AT_SECONDS_TE_MASK);
+		if (ARM_DRIVER_OK != status)
+		{
+			return SENSOR_ERROR_WRITE;
+		}
+	}
+
+	/*! Timer_value and Timer_mode in one burst, TE set after the value is loaded. */
+	frame.value = value;
+	frame.mode = (mode & keep) | (uint8_t)(tcf << PCF85063AT_SECONDS_TCF_SHIFT) | set;
+	status = Register_I2C_BlockWrite(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			PCF85063AT_TIMER_VALUE, (const uint8_t *)&frame, sizeof(frame));
+	if (ARM_DRIVER_OK != status)
+	{
+		pSensorHandle->shadowValid &= ~(1U << PCF85063AT_SHADOW_TIMER_MODE);
+		return SENSOR_ERROR_WRITE;
+	}
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_TIMER_MODE, frame.mode);
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Countdown_Start(PCF85063AT_sensorhandle_t *pSensorHandle, TCF tcf, uint8_t value)
+{
+	/*! Validate for the correct handle, source clock and value */
+	if ((pSensorHandle == NULL) || ((uint32_t)tcf > timer4) || (value == 0))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before triggering sensor reset.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	return PCF85063AT_TimerLoad(pSensorHandle, tcf, value, PCF85063AT_SECONDS_TI_TP_MASK,
+			(uint8_t)(intEnable << PCF85063AT_SECONDS_TE_SHIFT) | (uint8_t)(intEnable << PCF85063AT_SECONDS_TIE_SHIFT));
+}
+
+int32_t PCF85063AT_Countdown_Stop(PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	int32_t status;
+
+	/*! Validate for the correct handle */
+	if (pSensorHandle == NULL)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before triggering sensor reset.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	/*! Timer and its interrupt off in a single write */
+	status = PCF85063AT_UpdateRegister(pSensorHandle, PCF85063AT_TIMER_MODE, 0,
+			PCF85063AT_SECONDS_TE_MASK | PCF85063AT_SECONDS_TIE_MASK);
+	if (ARM_DRIVER_OK != status)
+	{
+		return SENSOR_ERROR_WRITE;
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_TimerPlan(uint64_t duration_us, PCF85063AT_timerplan_t *pPlan)
+{
+	/*! Source clock periods in 1/64 us, integers for every source clock. */
+	static const uint32_t s_tickLength[] = {15625U, 1000000U, 64000000U, 3840000000U};
+	uint64_t target;
+	uint64_t value;
+	uint64_t bestAbs = UINT64_MAX;
+	int64_t error;
+	uint32_t i;
+
+	/*! Validate for the correct plan and duration */
+	if ((pPlan == NULL) || (duration_us == 0) || (duration_us > PCF85063AT_TIMER_MAX_US))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	target = duration_us << 6;
+	for (i = 0; i < sizeof(s_tickLength) / sizeof(s_tickLength[0]); i++)
+	{
+		/*! Rounded value, clamped to the 8-bit Timer_value. */
+		value = (target + (s_tickLength[i] >> 1)) / s_tickLength[i];
+		if (value == 0)
+		{
+			value = 1;
+		}
+		else if (value > 255)
+		{
+			value = 255;
+		}
+
+		error = (int64_t)(value * s_tickLength[i]) - (int64_t)target;
+		if (error < 0)
+		{
+			error = -error;
+		}
+		if ((uint64_t)error < bestAbs)
+		{
+			bestAbs = (uint64_t)error;
+			pPlan->tcf = (TCF)i;
+			pPlan->value = (uint8_t)value;
+		}
+	}
+
+	pPlan->period_us = ((uint64_t)pPlan->value * s_tickLength[pPlan->tcf] + 32U) >> 6;
+	pPlan->error_us = (int32_t)((int64_t)pPlan->period_us - (int64_t)duration_us);
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_TimerPlan_Apply(PCF85063AT_sensorhandle_t *pSensorHandle, const PCF85063AT_timerplan_t *pPlan)
+{
+	/*! Validate for the correct handle and plan */
+	if ((pSensorHandle == NULL) || (pPlan == NULL) || ((uint32_t)pPlan->tcf > timer4) || (pPlan->value == 0))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before triggering sensor reset.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	return PCF85063AT_TimerLoad(pSensorHandle, pPlan->tcf, pPlan->value,
+			PCF85063AT_SECONDS_TI_TP_MASK | PCF85063AT_SECONDS_TIE_MASK | PCF85063AT_SECONDS_TE_MASK, 0);
+}
+
 int32_t PCF85063AT_Set_offset(PCF85063AT_sensorhandle_t *pSensorHandle, int8_t offset)
 {
 	int32_t status;
@@ -1414,8 +2369,8 @@ int32_t PCF85063AT_Set_offset(PCF85063AT_sensorhandle_t *pSensorHandle, int8_t o
 	}
 
 	/*! To choose offset*/
-	status = Register_I2C_Write(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo,pSensorHandle->slaveAddress,
-			PCF85063AT_OFFSET, offset, PCF85063AT_OFFSET_MASK ,repeatedStart);
+	status = PCF85063AT_UpdateRegister(pSensorHandle,
+			PCF85063AT_OFFSET, (uint8_t)(offset & PCF85063AT_OFFSET_MASK), PCF85063AT_OFFSET_MASK);
 	if (ARM_DRIVER_OK != status)
 	{
 		return SENSOR_ERROR_WRITE;
@@ -1423,3 +2378,198 @@ int32_t PCF85063AT_Set_offset(PCF85063AT_sensorhandle_t *pSensorHandle, int8_t o
 
 	return SENSOR_ERROR_NONE;
 }
+
+int32_t PCF85063AT_Get_Offset(PCF85063AT_sensorhandle_t *pSensorHandle, uint8_t *pOffset)
+{
+	int32_t status;
+
+	/*! Validate for the correct handle and Offset read variable.*/
+	if ((pSensorHandle == NULL) || (pOffset == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before triggering sensor reset.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	/*! Offset from the shadow, read once when it is not valid. */
+	if (!(pSensorHandle->shadowValid & (1U << PCF85063AT_SHADOW_OFFSET)))
+	{
+		status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+				PCF85063AT_OFFSET, PCF85063AT_REG_SIZE_BYTE, pOffset);
+		if (ARM_DRIVER_OK != status)
+		{
+			return SENSOR_ERROR_READ;
+		}
+		PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_OFFSET, *pOffset);
+	}
+	*pOffset = pSensorHandle->shadowReg[PCF85063AT_SHADOW_OFFSET];
+
+	return SENSOR_ERROR_NONE;
+}
+
+//-----------------------------------------------------------------------
+// Register file snapshot
+//-----------------------------------------------------------------------
+
+/*! Location and name of each PCF85063AT_FIELD, in address order. */
+static const struct
+{
+	uint8_t offset;
+	uint8_t mask;
+	const char *name;
+} s_snapshotFields[PCF85063AT_FIELD_COUNT] = {
+	{PCF85063AT_CTRL1, PCF85063AT_CTRL1_EXT_TEST_MASK, "CTRL1.EXT_TEST"},
+	{PCF85063AT_CTRL1, PCF85063AT_CTRL1_START_STOP_MASK, "CTRL1.STOP"},
+	{PCF85063AT_CTRL1, PCF85063AT_CTRL1_CIE_MASK, "CTRL1.CIE"},
+	{PCF85063AT_CTRL1, PCF85063AT_CTRL1_12_HOUR_24_HOUR_MODE_MASK, "CTRL1.12_24"},
+	{PCF85063AT_CTRL1, PCF85063AT_CTRL1_CAP_SEL_MASK, "CTRL1.CAP_SEL"},
+	{PCF85063AT_CTRL2, PCF85063AT_CTRL2_AIE_MASK, "CTRL2.AIE"},
+	{PCF85063AT_CTRL2, PCF85063AT_CTRL2_AF_MASK, "CTRL2.AF"},
+	{PCF85063AT_CTRL2, PCF85063AT_CTRL2_MI_MASK, "CTRL2.MI"},
+	{PCF85063AT_CTRL2, PCF85063AT_CTRL2_HMI_MASK, "CTRL2.HMI"},
+	{PCF85063AT_CTRL2, PCF85063AT_CTRL2_TF_MASK, "CTRL2.TF"},
+	{PCF85063AT_CTRL2, PCF85063AT_CTRL2_COF_MASK, "CTRL2.COF"},
+	{PCF85063AT_OFFSET, PCF85063AT_OFFSET_MODE_MASK, "OFFSET.MODE"},
+	{PCF85063AT_OFFSET, PCF85063AT_OFFSET_MASK, "OFFSET.OFFSET"},
+	{PCF85063AT_RAM_BYTE, PCF85063AT_RAM_BYTE_MASK, "RAM_BYTE"},
+	{PCF85063AT_SECOND, PCF85063AT_OS_MASK, "SECONDS.OS"},
+	{PCF85063AT_SECOND, PCF85063AT_SECONDS_MASK, "SECONDS"},
+	{PCF85063AT_MINUTE, PCF85063AT_MINUTES_MASK, "MINUTES"},
+	{PCF85063AT_HOUR, PCF85063AT_HOURS_MASk_24H, "HOURS"},
+	{PCF85063AT_DAY, PCF85063AT_DAYS_MASK, "DAYS"},
+	{PCF85063AT_WEEKDAY, PCF85063AT_WEEKDAYS_MASK, "WEEKDAYS"},
+	{PCF85063AT_MONTH, PCF85063AT_MONTHS_MASK, "MONTHS"},
+	{PCF85063AT_YEAR, PCF85063AT_YEARS_MASK, "YEARS"},
+	{PCF85063AT_SECOND_ALARM, PCF85063AT_AEN_S_MASK, "SECOND_ALARM.AEN_S"},
+	{PCF85063AT_SECOND_ALARM, PCF85063AT_SECONDS_ALARM_MASK, "SECOND_ALARM"},
+	{PCF85063AT_MINUTE_ALARM, PCF85063AT_AEN_M_MASK, "MINUTE_ALARM.AEN_M"},
+	{PCF85063AT_MINUTE_ALARM, PCF85063AT_MINUTES_ALARM_MASK, "MINUTE_ALARM"},
+	{PCF85063AT_HOUR_ALARM, PCF85063AT_AEN_H_MASK, "HOUR_ALARM.AEN_H"},
+	{PCF85063AT_HOUR_ALARM, PCF85063AT_HOURS_ALARM_MASK_24H, "HOUR_ALARM"},
+	{PCF85063AT_DAY_ALARM, PCF85063AT_AEN_D_MASK, "DAY_ALARM.AEN_D"},
+	{PCF85063AT_DAY_ALARM, PCF85063AT_DAYS_ALARM_MASK, "DAY_ALARM"},
+	{PCF85063AT_WEEKDAY_ALARM, PCF85063AT_AEN_W_MASK, "WEEKDAY_ALARM.AEN_W"},
+	{PCF85063AT_WEEKDAY_ALARM, PCF85063AT_WEEKDAYS_ALARM_MASK, "WEEKDAY_ALARM"},
+	{PCF85063AT_TIMER_VALUE, PCF85063AT_SECONDS_TS_MASK, "TIMER_VALUE"},
+	{PCF85063AT_TIMER_MODE, PCF85063AT_SECONDS_TCF_MASK, "TIMER_MODE.TCF"},
+	{PCF85063AT_TIMER_MODE, PCF85063AT_SECONDS_TE_MASK, "TIMER_MODE.TE"},
+	{PCF85063AT_TIMER_MODE, PCF85063AT_SECONDS_TIE_MASK, "TIMER_MODE.TIE"},
+	{PCF85063AT_TIMER_MODE, PCF85063AT_SECONDS_TI_TP_MASK, "TIMER_MODE.TI_TP"},
+};
+
+int32_t PCF85063AT_Snapshot(PCF85063AT_sensorhandle_t *pSensorHandle, PCF85063AT_snapshot_t *pSnapshot)
+{
+	int32_t status;
+
+	/*! Validate for the correct handle and snapshot variable.*/
+	if ((pSensorHandle == NULL) || (pSnapshot == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether sensor handle is initialized before triggering sensor reset.*/
+	if (pSensorHandle->isInitialized != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	/*! Control_1 to Timer_mode in one burst, the register file as seen at a single instant. */
+	status = Register_I2C_Read(pSensorHandle->pCommDrv, &pSensorHandle->deviceInfo, pSensorHandle->slaveAddress,
+			PCF85063AT_CTRL1, sizeof(*pSnapshot), (uint8_t *)pSnapshot);
+	if (ARM_DRIVER_OK != status)
+	{
+		return SENSOR_ERROR_READ;
+	}
+
+	/*! Every shadowed register came along, refresh the shadow. */
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_CTRL1, pSnapshot->ctrl1);
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_CTRL2, pSnapshot->ctrl2);
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_OFFSET, pSnapshot->offset);
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_RAM_BYTE, pSnapshot->ramByte);
+	PCF85063AT_ShadowStore(pSensorHandle, PCF85063AT_TIMER_MODE, pSnapshot->timer.mode);
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Snapshot_Decode(const PCF85063AT_snapshot_t *pSnapshot, PCF85063AT_timedata_t *time,
+		PCF85063AT_alarmdata_t *alarmtime)
+{
+	PCF85063AT_CTRL_1 Ctrl1_Reg;
+
+	/*! Validate for the correct snapshot variable.*/
+	if (pSnapshot == NULL)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	Ctrl1_Reg.w = pSnapshot->ctrl1;
+	if (alarmtime != NULL)
+	{
+		PCF85063AT_BcdToAlarm(&pSnapshot->alarm, (Mode12h_24h)Ctrl1_Reg.b.mode_12_24, alarmtime);
+	}
+	if (time != NULL)
+	{
+		return PCF85063AT_BcdToTime(&pSnapshot->time, (Mode12h_24h)Ctrl1_Reg.b.mode_12_24, time);
+	}
+
+	return SENSOR_ERROR_NONE;
+}
+
+uint8_t PCF85063AT_Snapshot_GetField(const PCF85063AT_snapshot_t *pSnapshot, PCF85063AT_FIELD field)
+{
+	uint8_t mask;
+
+	if ((pSnapshot == NULL) || ((uint32_t)field >= PCF85063AT_FIELD_COUNT))
+	{
+		return 0;
+	}
+
+	/*! Shift the field down by the trailing zeros of its mask. */
+	mask = s_snapshotFields[field].mask;
+	return (uint8_t)((((const uint8_t *)pSnapshot)[s_snapshotFields[field].offset] & mask) / (mask & -mask));
+}
+
+const char *PCF85063AT_FieldName(PCF85063AT_FIELD field)
+{
+	if ((uint32_t)field >= PCF85063AT_FIELD_COUNT)
+	{
+		return "?";
+	}
+
+	return s_snapshotFields[field].name;
+}
+
+uint32_t PCF85063AT_SnapshotDiff(const PCF85063AT_snapshot_t *pOld, const PCF85063AT_snapshot_t *pNew,
+		PCF85063AT_FIELD *pFields, uint32_t maxFields)
+{
+	const uint8_t *oldRegs = (const uint8_t *)pOld;
+	const uint8_t *newRegs = (const uint8_t *)pNew;
+	uint8_t changed;
+	uint32_t field;
+	uint32_t count = 0;
+
+	if ((pOld == NULL) || (pNew == NULL))
+	{
+		return 0;
+	}
+
+	for (field = 0; field < PCF85063AT_FIELD_COUNT; field++)
+	{
+		/*! Fields of unchanged registers are skipped with a single compare. */
+		changed = oldRegs[s_snapshotFields[field].offset] ^ newRegs[s_snapshotFields[field].offset];
+		if (changed & s_snapshotFields[field].mask)
+		{
+			if ((pFields != NULL) && (count < maxFields))
+			{
+				pFields[count] = (PCF85063AT_FIELD)field;
+			}
+			count++;
+		}
+	}
+
+	return count;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * pcf85063at_timebase.c
+ *
+ * @file pcf85063at_timebase.c
+ * @brief The pcf85063at_timebase.c file implements the sub-second timestamp service.
+ *        The RTC seconds are anchored to the SysTick count on a seconds edge, timestamps are
+ *        then computed from the SysTick alone.
+ */
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+
+#include "pcf85063at_timebase.h"
+#include "systick_utils.h"
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+
+int32_t PCF85063AT_Timebase_Init(PCF85063AT_timebase_t *pTimebase, uint32_t ticksPerSecond)
+{
+	/*! Validate for the correct timebase, microScale needs more than one tick per microsecond.*/
+	if ((pTimebase == NULL) || (ticksPerSecond <= 1000000U))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	pTimebase->sequence = 0;
+	pTimebase->epoch = 0;
+	pTimebase->tick = 0;
+	pTimebase->ticksPerSecond = ticksPerSecond;
+	/*! Reciprocal so that the microseconds only need a multiplication. */
+	pTimebase->microScale = (uint32_t)((1000000ULL << 32) / ticksPerSecond);
+	pTimebase->isSynced = false;
+
+	return SENSOR_ERROR_NONE;
+}
+
+/*! Move the anchor, readers retry while sequence is odd. */
+static void PCF85063AT_Timebase_SetAnchor(PCF85063AT_timebase_t *pTimebase, uint32_t epoch, uint64_t tick)
+{
+	pTimebase->sequence++;
+	pTimebase->epoch = epoch;
+	pTimebase->tick = tick;
+	pTimebase->sequence++;
+}
+
+int32_t PCF85063AT_Timebase_Sync(PCF85063AT_timebase_t *pTimebase, PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	int32_t status;
+	uint8_t firstSecond;
+	uint64_t start, tick;
+	uint32_t epoch;
+	PCF85063AT_timedata_t time;
+
+	/*! Validate for the correct timebase and handle.*/
+	if ((pTimebase == NULL) || (pSensorHandle == NULL) || (pTimebase->ticksPerSecond == 0))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	status = PCF85063AT_GetTimeCoherent(pSensorHandle, &time, NULL, NULL);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+	firstSecond = time.second;
+
+	/*! Poll for the seconds edge, the time registers are frozen when a read starts. */
+	start = BOARD_SystickGetTicks64();
+	do
+	{
+		tick = BOARD_SystickGetTicks64();
+		if ((tick - start) > ((uint64_t)pTimebase->ticksPerSecond * PCF85063AT_TIMEBASE_SYNC_TIMEOUT_S))
+		{
+			return SENSOR_ERROR_READ;
+		}
+		status = PCF85063AT_GetTimeCoherent(pSensorHandle, &time, NULL, NULL);
+		if (SENSOR_ERROR_NONE != status)
+		{
+			return status;
+		}
+	} while (time.second == firstSecond);
+
+	status = PCF85063AT_TimeToEpoch(&time, &epoch);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	PCF85063AT_Timebase_SetAnchor(pTimebase, epoch, tick);
+	pTimebase->isSynced = true;
+
+	return SENSOR_ERROR_NONE;
+}
+
+void PCF85063AT_Timebase_SecondEdge(PCF85063AT_timebase_t *pTimebase, uint32_t seconds)
+{
+	if ((pTimebase == NULL) || (pTimebase->isSynced != true))
+	{
+		return;
+	}
+
+	PCF85063AT_Timebase_SetAnchor(pTimebase, pTimebase->epoch + seconds, BOARD_SystickGetTicks64());
+}
+
+int32_t PCF85063AT_Timebase_Get(PCF85063AT_timebase_t *pTimebase, PCF85063AT_timestamp_t *pTimestamp)
+{
+	uint32_t sequence, epoch, seconds;
+	uint64_t tick, elapsed;
+
+	/*! Validate for the correct timebase and timestamp variable.*/
+	if ((pTimebase == NULL) || (pTimestamp == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! Check whether the timebase is anchored.*/
+	if (pTimebase->isSynced != true)
+	{
+		return SENSOR_ERROR_INIT;
+	}
+
+	/*! Consistent copy of the anchor, even if an edge interrupt moves it meanwhile. */
+	do
+	{
+		sequence = pTimebase->sequence;
+		epoch = pTimebase->epoch;
+		tick = pTimebase->tick;
+	} while ((sequence & 0x01) || (sequence != pTimebase->sequence));
+
+	elapsed = BOARD_SystickGetTicks64() - tick;
+
+	/*! One division, exact whatever the time since the last edge. */
+	seconds = (uint32_t)(elapsed / pTimebase->ticksPerSecond);
+	elapsed -= (uint64_t)seconds * pTimebase->ticksPerSecond;
+
+	pTimestamp->seconds = epoch + seconds;
+	pTimestamp->microseconds = (uint32_t)((elapsed * pTimebase->microScale) >> 32);
+
+	return SENSOR_ERROR_NONE;
+}
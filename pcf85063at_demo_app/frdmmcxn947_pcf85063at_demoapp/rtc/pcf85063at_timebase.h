@@ -0,0 +1,94 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_timebase.h
+ * @brief The pcf85063at_timebase.h file declares the sub-second timestamp service which extends
+ *        the RTC seconds with the SysTick timebase.
+ */
+
+#ifndef PCF85063AT_TIMEBASE_H_
+#define PCF85063AT_TIMEBASE_H_
+
+#include "pcf85063at_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @def    PCF85063AT_TIMEBASE_SYNC_TIMEOUT_S
+ *  @brief  Seconds PCF85063AT_Timebase_Sync() waits for a seconds edge before giving up. */
+#define PCF85063AT_TIMEBASE_SYNC_TIMEOUT_S    (2)
+
+/*! @brief This structure defines a timestamp in Unix seconds and microseconds.*/
+typedef struct
+{
+	uint32_t seconds;        /*!< Seconds since 1970-01-01 00:00:00 UTC.*/
+	uint32_t microseconds;   /*!< Microseconds within the second, 0 to 999999.*/
+} PCF85063AT_timestamp_t;
+
+/*! @brief This structure defines the anchor between the RTC seconds and the SysTick count.*/
+typedef struct
+{
+	volatile uint32_t sequence;  /*!< Odd while the anchor is being updated.*/
+	volatile uint32_t epoch;     /*!< RTC second of the last edge.*/
+	volatile uint64_t tick;      /*!< SysTick count latched at the last edge.*/
+	uint32_t ticksPerSecond;     /*!< SysTick frequency.*/
+	uint32_t microScale;         /*!< 10^6 * 2^32 / ticksPerSecond, rounded down.*/
+	bool isSynced;               /*!< Whether the anchor is valid.*/
+} PCF85063AT_timebase_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+/*! @brief       Initializes the timestamp service.
+ *  @details     The SysTick must be running, see BOARD_SystickEnable().
+ *  @param[in]   pTimebase  		Pointer to the timebase.
+ *  @param[in]   ticksPerSecond  	SysTick frequency, normally CLOCK_GetFreq(kCLOCK_CoreSysClk).
+ *  @constraints None
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Timebase_Init() returns the status.
+ */
+int32_t PCF85063AT_Timebase_Init(PCF85063AT_timebase_t *pTimebase, uint32_t ticksPerSecond);
+
+/*! @brief       Anchors the timestamp service on a seconds edge of the RTC.
+ *  @details     Polls Control_1 to Years until the seconds change and latches the SysTick count of the read
+ *               which saw the change. The anchor is late by at most one burst read. This is the only call
+ *               which uses the bus.
+ *  @param[in]   pTimebase  		Pointer to the timebase.
+ *  @param[in]   pSensorHandle  	Pointer to sensor handle structure.
+ *  @constraints This can be called any number of times only after PCF85063AT_Initialize().
+ *				 Application has to ensure that previous instances of these APIs have exited before invocation
+ *  @reentrant   No
+ *  @return      ::PCF85063AT_Timebase_Sync() returns SENSOR_ERROR_READ when no edge is seen within
+ *               PCF85063AT_TIMEBASE_SYNC_TIMEOUT_S, e.g. when the RTC is stopped.
+ */
+int32_t PCF85063AT_Timebase_Sync(PCF85063AT_timebase_t *pTimebase, PCF85063AT_sensorhandle_t *pSensorHandle);
+
+/*! @brief       Moves the anchor to a seconds edge signalled by the RTC.
+ *  @details     Call from the interrupt of an edge which falls on a whole second: 1 for CLKOUT at 1 Hz,
+ *               30 for the half minute interrupt, 60 for the minute interrupt. Keeps the anchor within the
+ *               interrupt latency of the RTC, without any bus access.
+ *  @param[in]   pTimebase  		Pointer to the timebase.
+ *  @param[in]   seconds  			Seconds since the previous edge.
+ *  @constraints PCF85063AT_Timebase_Sync() must have succeeded, the edge must be the first one after the anchor.
+ *  @reentrant   No
+ */
+void PCF85063AT_Timebase_SecondEdge(PCF85063AT_timebase_t *pTimebase, uint32_t seconds);
+
+/*! @brief       Gets the current time with microsecond resolution.
+ *  @details     Adds the SysTick count since the anchor to the anchored second, no bus access.
+ *               Safe to call from interrupts.
+ *  @param[in]   pTimebase  		Pointer to the timebase.
+ *  @param[out]  pTimestamp  		Pointer to the timestamp.
+ *  @constraints None
+ *  @reentrant   Yes
+ *  @return      ::PCF85063AT_Timebase_Get() returns SENSOR_ERROR_INIT until the service is synced.
+ */
+int32_t PCF85063AT_Timebase_Get(PCF85063AT_timebase_t *pTimebase, PCF85063AT_timestamp_t *pTimestamp);
+
+#endif /* PCF85063AT_TIMEBASE_H_ */
@@ -0,0 +1,499 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * pcf85063at_wheel.c
+ *
+ * @file pcf85063at_wheel.c
+ * @brief The pcf85063at_wheel.c file implements the hierarchical timer wheel of the PCF85063AT RTC.
+ *
+ * A timer expiring delta ticks ahead sits at the level where delta is below 64^(level + 1), in the slot
+ * selected by its expiry shifted by 6 * level bits. When the wheel reaches the start of a slot of level 1 or
+ * above, the slot is cascaded: its timers move to the lower levels. Cascading is done in software while the
+ * wheel advances, the countdown timer is only loaded for actual expiries.
+ */
+
+#include <string.h>
+
+//-----------------------------------------------------------------------
+// ISSDK Includes
+//-----------------------------------------------------------------------
+
+#include "pcf85063at_wheel.h"
+
+//-----------------------------------------------------------------------
+// Global Variables
+//-----------------------------------------------------------------------
+
+/*! Wheel ticks per period of the countdown timer source clocks the wheel uses. */
+#define PCF85063AT_WHEEL_TICKS_64HZ    (1U)
+#define PCF85063AT_WHEEL_TICKS_1HZ     (PCF85063AT_WHEEL_TICK_HZ)
+#define PCF85063AT_WHEEL_TICKS_1_60HZ  (60U * PCF85063AT_WHEEL_TICK_HZ)
+
+/*! Largest value of the countdown timer. */
+#define PCF85063AT_WHEEL_MAX_VALUE     (255U)
+
+/*! Position of the lowest set bit of a power of two, indexed by de Bruijn sequence. */
+static const uint8_t s_wheelDeBruijn[32] = {
+	0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+	31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9,
+};
+
+//-----------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------
+
+/*! Index of the lowest set bit of a non-zero word. */
+static uint32_t PCF85063AT_Wheel_FirstSet(uint32_t word)
+{
+	return s_wheelDeBruijn[((word & (0U - word)) * 0x077CB531U) >> 27];
+}
+
+/*! Distance from slot from to the first occupied slot, wrapping around the level.
+ *  PCF85063AT_WHEEL_SLOTS when the level is empty. */
+static uint32_t PCF85063AT_Wheel_NextSlot(const uint32_t *pOccupied, uint32_t from)
+{
+	uint32_t half = from >> 5;
+	uint32_t above = 0xFFFFFFFFU << (from & 31U);
+	uint32_t word;
+
+	/*! From the starting slot to the end of its word, the other word, then the start of the first word. */
+	word = pOccupied[half] & above;
+	if (word)
+	{
+		return ((half << 5) + PCF85063AT_Wheel_FirstSet(word) - from) & (PCF85063AT_WHEEL_SLOTS - 1U);
+	}
+	word = pOccupied[half ^ 1U];
+	if (word)
+	{
+		return (((half ^ 1U) << 5) + PCF85063AT_Wheel_FirstSet(word) - from) & (PCF85063AT_WHEEL_SLOTS - 1U);
+	}
+	word = pOccupied[half] & ~above;
+	if (word)
+	{
+		return ((half << 5) + PCF85063AT_Wheel_FirstSet(word) - from) & (PCF85063AT_WHEEL_SLOTS - 1U);
+	}
+
+	return PCF85063AT_WHEEL_SLOTS;
+}
+
+/*! Link a timer into the slot of its expiry. */
+static void PCF85063AT_Wheel_Link(PCF85063AT_timerwheel_t *pWheel, PCF85063AT_swtimer_t *pTimer)
+{
+	uint32_t delta = pTimer->expires - pWheel->now;
+	uint32_t expires = pTimer->expires;
+	uint32_t level = 0;
+	PCF85063AT_swtimer_t **ppHead;
+
+	while ((level < PCF85063AT_WHEEL_LEVELS - 1U) &&
+			(delta >= (1U << (PCF85063AT_WHEEL_SLOT_BITS * (level + 1U)))))
+	{
+		level++;
+	}
+	/*! Beyond the top level, park in its farthest slot and place again when it is cascaded. */
+	if (delta >= (1U << (PCF85063AT_WHEEL_SLOT_BITS * PCF85063AT_WHEEL_LEVELS)))
+	{
+		expires = pWheel->now + (1U << (PCF85063AT_WHEEL_SLOT_BITS * PCF85063AT_WHEEL_LEVELS)) - 1U;
+	}
+
+	pTimer->level = (uint8_t)level;
+	pTimer->slot = (uint8_t)((expires >> (PCF85063AT_WHEEL_SLOT_BITS * level)) & (PCF85063AT_WHEEL_SLOTS - 1U));
+
+	ppHead = &pWheel->slot[level][pTimer->slot];
+	pTimer->pNext = *ppHead;
+	if (*ppHead != NULL)
+	{
+		(*ppHead)->ppPrev = &pTimer->pNext;
+	}
+	*ppHead = pTimer;
+	pTimer->ppPrev = ppHead;
+	pWheel->occupied[level][pTimer->slot >> 5] |= (1U << (pTimer->slot & 31U));
+	pWheel->count++;
+}
+
+/*! Unlink a running timer. */
+static void PCF85063AT_Wheel_Unlink(PCF85063AT_timerwheel_t *pWheel, PCF85063AT_swtimer_t *pTimer)
+{
+	*pTimer->ppPrev = pTimer->pNext;
+	if (pTimer->pNext != NULL)
+	{
+		pTimer->pNext->ppPrev = pTimer->ppPrev;
+	}
+	if (pWheel->slot[pTimer->level][pTimer->slot] == NULL)
+	{
+		pWheel->occupied[pTimer->level][pTimer->slot >> 5] &= ~(1U << (pTimer->slot & 31U));
+	}
+	pTimer->ppPrev = NULL;
+	pWheel->count--;
+}
+
+/*! Ticks to the next expiry of level 0 or slot start of a higher level, 0 when the wheel is empty. */
+static uint32_t PCF85063AT_Wheel_NextStep(PCF85063AT_timerwheel_t *pWheel)
+{
+	uint32_t level, shift, current, distance, step;
+	uint32_t next = 0;
+
+	for (level = 0; level < PCF85063AT_WHEEL_LEVELS; level++)
+	{
+		shift = PCF85063AT_WHEEL_SLOT_BITS * level;
+		current = pWheel->now >> shift;
+		distance = PCF85063AT_Wheel_NextSlot(pWheel->occupied[level], (current + 1U) & (PCF85063AT_WHEEL_SLOTS - 1U));
+		if (distance == PCF85063AT_WHEEL_SLOTS)
+		{
+			continue;
+		}
+		step = ((current + 1U + distance) << shift) - pWheel->now;
+		if ((next == 0) || (step < next))
+		{
+			next = step;
+		}
+	}
+
+	return next;
+}
+
+/*! Ticks to the soonest expiry, 0 when the wheel is empty. The first occupied slot of a level holds the
+ *  soonest timers of that level, the slots of a level covering consecutive ranges. */
+static uint32_t PCF85063AT_Wheel_NextExpiry(PCF85063AT_timerwheel_t *pWheel)
+{
+	uint32_t level, current, distance, delta;
+	uint32_t next = 0;
+	PCF85063AT_swtimer_t *pTimer;
+
+	for (level = 0; level < PCF85063AT_WHEEL_LEVELS; level++)
+	{
+		current = pWheel->now >> (PCF85063AT_WHEEL_SLOT_BITS * level);
+		distance = PCF85063AT_Wheel_NextSlot(pWheel->occupied[level], (current + 1U) & (PCF85063AT_WHEEL_SLOTS - 1U));
+		if (distance == PCF85063AT_WHEEL_SLOTS)
+		{
+			continue;
+		}
+		pTimer = pWheel->slot[level][(current + 1U + distance) & (PCF85063AT_WHEEL_SLOTS - 1U)];
+		for (; pTimer != NULL; pTimer = pTimer->pNext)
+		{
+			delta = pTimer->expires - pWheel->now;
+			if ((next == 0) || (delta < next))
+			{
+				next = delta;
+			}
+		}
+	}
+
+	return next;
+}
+
+/*! Cascade the slots starting at the current tick, then expire the timers of the current tick. */
+static void PCF85063AT_Wheel_Tick(PCF85063AT_timerwheel_t *pWheel)
+{
+	uint32_t level, shift, index;
+	PCF85063AT_swtimer_t *pTimer;
+
+	for (level = 1; level < PCF85063AT_WHEEL_LEVELS; level++)
+	{
+		shift = PCF85063AT_WHEEL_SLOT_BITS * level;
+		if (pWheel->now & ((1U << shift) - 1U))
+		{
+			break;
+		}
+		index = (pWheel->now >> shift) & (PCF85063AT_WHEEL_SLOTS - 1U);
+		while ((pTimer = pWheel->slot[level][index]) != NULL)
+		{
+			PCF85063AT_Wheel_Unlink(pWheel, pTimer);
+			PCF85063AT_Wheel_Link(pWheel, pTimer);
+		}
+	}
+
+	/*! Timers restarted from here expire at least one tick ahead, so never land in this slot again. */
+	index = pWheel->now & (PCF85063AT_WHEEL_SLOTS - 1U);
+	while ((pTimer = pWheel->slot[0][index]) != NULL)
+	{
+		PCF85063AT_Wheel_Unlink(pWheel, pTimer);
+		if (pTimer->period)
+		{
+			pTimer->expires += pTimer->period;
+			PCF85063AT_Wheel_Link(pWheel, pTimer);
+		}
+		pTimer->callback(pTimer, pTimer->pUserData);
+	}
+}
+
+/*! Move the wheel to target, expiring the timers met on the way. */
+static void PCF85063AT_Wheel_Advance(PCF85063AT_timerwheel_t *pWheel, uint32_t target)
+{
+	uint32_t step;
+
+	/*! Callbacks may start or stop timers, the countdown timer is loaded once they are done. */
+	pWheel->inProcess = true;
+	while ((int32_t)(target - pWheel->now) > 0)
+	{
+		step = PCF85063AT_Wheel_NextStep(pWheel);
+		if ((step == 0) || (step > target - pWheel->now))
+		{
+			pWheel->now = target;
+			break;
+		}
+		pWheel->now += step;
+		PCF85063AT_Wheel_Tick(pWheel);
+	}
+	pWheel->inProcess = false;
+}
+
+/*! Load the countdown timer for the soonest expiry, or stop it when no timer runs.
+ *  At an expiry the countdown timer has reloaded itself, so an unchanged load keeps running. */
+static int32_t PCF85063AT_Wheel_Load(PCF85063AT_timerwheel_t *pWheel, bool atExpiry)
+{
+	int32_t status;
+	uint32_t next, periodTicks, value;
+	TCF tcf;
+
+	if (pWheel->inProcess)
+	{
+		return SENSOR_ERROR_NONE;
+	}
+
+	if (pWheel->count == 0)
+	{
+		if (pWheel->programmed == 0)
+		{
+			return SENSOR_ERROR_NONE;
+		}
+		pWheel->programmed = 0;
+		return PCF85063AT_Countdown_Stop(pWheel->pSensorHandle);
+	}
+
+	/*! The finest source clock reaching the expiry in one load, a coarser remainder takes another load. */
+	next = PCF85063AT_Wheel_NextExpiry(pWheel);
+	if (next <= PCF85063AT_WHEEL_MAX_VALUE * PCF85063AT_WHEEL_TICKS_64HZ)
+	{
+		tcf = timer2;
+		periodTicks = PCF85063AT_WHEEL_TICKS_64HZ;
+	}
+	else if (next <= PCF85063AT_WHEEL_MAX_VALUE * PCF85063AT_WHEEL_TICKS_1HZ)
+	{
+		tcf = timer3;
+		periodTicks = PCF85063AT_WHEEL_TICKS_1HZ;
+	}
+	else
+	{
+		tcf = timer4;
+		periodTicks = PCF85063AT_WHEEL_TICKS_1_60HZ;
+	}
+	value = next / periodTicks;
+	if (value > PCF85063AT_WHEEL_MAX_VALUE)
+	{
+		value = PCF85063AT_WHEEL_MAX_VALUE;
+	}
+	else if (value == 0)
+	{
+		value = 1;
+	}
+
+	if (atExpiry && pWheel->programmed && (pWheel->tcf == tcf) && (pWheel->value == value))
+	{
+		return SENSOR_ERROR_NONE;
+	}
+
+	/*! Marked stopped first, so that a failure below is retried by the next start. */
+	pWheel->programmed = 0;
+	status = PCF85063AT_Countdown_Start(pWheel->pSensorHandle, tcf, (uint8_t)value);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	pWheel->programmed = value * periodTicks;
+	pWheel->tcf = tcf;
+	pWheel->value = (uint8_t)value;
+	pWheel->loads++;
+
+	return SENSOR_ERROR_NONE;
+}
+
+/*! Ticks elapsed since the wheel tick, taken from the countdown value of the load under way: exact to the tick
+ *  on the 64 Hz source clock, within its period on a coarser one, narrowed there by the RTC seconds. */
+static int32_t PCF85063AT_Wheel_Elapsed(PCF85063AT_timerwheel_t *pWheel, uint32_t *pElapsed)
+{
+	int32_t status;
+	uint32_t epoch, estimate, periodTicks;
+	uint32_t first = 0, span = 0;
+	uint8_t remaining;
+
+	if (pWheel->programmed)
+	{
+		status = PCF85063AT_Get_TimerValue(pWheel->pSensorHandle, &remaining);
+		if (SENSOR_ERROR_NONE != status)
+		{
+			return status;
+		}
+
+		/*! The countdown value steps at the end of each source clock period, the one under way is partly over. */
+		periodTicks = pWheel->programmed / pWheel->value;
+		if ((remaining != 0) && (remaining <= pWheel->value))
+		{
+			first = (pWheel->value - remaining) * periodTicks;
+			span = periodTicks;
+		}
+		else
+		{
+			span = pWheel->programmed;
+		}
+		if (span == 1U)
+		{
+			*pElapsed = first;
+			return SENSOR_ERROR_NONE;
+		}
+	}
+
+	status = PCF85063AT_GetEpoch(pWheel->pSensorHandle, &epoch);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+	estimate = (epoch - pWheel->anchorEpoch) * PCF85063AT_WHEEL_TICK_HZ - pWheel->now;
+	if ((int32_t)(estimate - first) < 0)
+	{
+		estimate = first;
+	}
+	else if (span && ((estimate - first) >= span))
+	{
+		estimate = first + span - 1U;
+	}
+	*pElapsed = estimate;
+
+	return SENSOR_ERROR_NONE;
+}
+
+int32_t PCF85063AT_Wheel_Init(PCF85063AT_timerwheel_t *pWheel, PCF85063AT_sensorhandle_t *pSensorHandle)
+{
+	int32_t status;
+
+	/*! Validate for the correct wheel and handle.*/
+	if ((pWheel == NULL) || (pSensorHandle == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	memset(pWheel, 0, sizeof(PCF85063AT_timerwheel_t));
+	pWheel->pSensorHandle = pSensorHandle;
+
+	status = PCF85063AT_GetEpoch(pSensorHandle, &pWheel->anchorEpoch);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+
+	return PCF85063AT_Countdown_Stop(pSensorHandle);
+}
+
+int32_t PCF85063AT_Wheel_Start(PCF85063AT_timerwheel_t *pWheel, PCF85063AT_swtimer_t *pTimer, uint32_t ticks,
+		uint32_t period, PCF85063AT_swtimercallback_t callback, void *pUserData)
+{
+	int32_t status;
+	uint32_t elapsed;
+
+	/*! Validate for the correct wheel, timer, callback and timeouts.*/
+	if ((pWheel == NULL) || (pTimer == NULL) || (callback == NULL) || (ticks == 0) ||
+			(ticks > PCF85063AT_WHEEL_MAX_TICKS) || (period > PCF85063AT_WHEEL_MAX_TICKS))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	if (pTimer->ppPrev != NULL)
+	{
+		PCF85063AT_Wheel_Unlink(pWheel, pTimer);
+	}
+	pTimer->period = period;
+	pTimer->callback = callback;
+	pTimer->pUserData = pUserData;
+
+	/*! Within a callback the wheel stands at the expiry being processed. */
+	if (pWheel->inProcess)
+	{
+		pTimer->expires = pWheel->now + ticks;
+		PCF85063AT_Wheel_Link(pWheel, pTimer);
+		return SENSOR_ERROR_NONE;
+	}
+
+	/*! Otherwise place the current tick within the countdown period under way. */
+	status = PCF85063AT_Wheel_Elapsed(pWheel, &elapsed);
+	if (SENSOR_ERROR_NONE != status)
+	{
+		return status;
+	}
+	pTimer->expires = pWheel->now + elapsed + ticks;
+
+	/*! Expiring after the countdown timer, which will load for it in turn. */
+	if (pWheel->programmed && ((pTimer->expires - pWheel->now) >= pWheel->programmed))
+	{
+		PCF85063AT_Wheel_Link(pWheel, pTimer);
+		return SENSOR_ERROR_NONE;
+	}
+
+	/*! The soonest expiry, the countdown timer restarts from the current tick. */
+	PCF85063AT_Wheel_Advance(pWheel, pWheel->now + elapsed);
+	PCF85063AT_Wheel_Link(pWheel, pTimer);
+
+	return PCF85063AT_Wheel_Load(pWheel, false);
+}
+
+int32_t PCF85063AT_Wheel_Stop(PCF85063AT_timerwheel_t *pWheel, PCF85063AT_swtimer_t *pTimer)
+{
+	/*! Validate for the correct wheel and timer.*/
+	if ((pWheel == NULL) || (pTimer == NULL))
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	if (pTimer->ppPrev == NULL)
+	{
+		return SENSOR_ERROR_NONE;
+	}
+
+	PCF85063AT_Wheel_Unlink(pWheel, pTimer);
+	if (pWheel->count)
+	{
+		return SENSOR_ERROR_NONE;
+	}
+
+	return PCF85063AT_Wheel_Load(pWheel, false);
+}
+
+bool PCF85063AT_Wheel_IsRunning(const PCF85063AT_swtimer_t *pTimer)
+{
+	return (pTimer != NULL) && (pTimer->ppPrev != NULL);
+}
+
+int32_t PCF85063AT_Wheel_Process(PCF85063AT_timerwheel_t *pWheel)
+{
+	/*! Validate for the correct wheel.*/
+	if ((pWheel == NULL) || pWheel->inProcess)
+	{
+		return SENSOR_ERROR_INVALID_PARAM;
+	}
+
+	/*! TF of a countdown timer the wheel did not load. */
+	if (pWheel->programmed == 0)
+	{
+		return SENSOR_ERROR_NONE;
+	}
+
+	pWheel->expiries++;
+	PCF85063AT_Wheel_Advance(pWheel, pWheel->now + pWheel->programmed);
+
+	return PCF85063AT_Wheel_Load(pWheel, true);
+}
+
+void PCF85063AT_Wheel_OnEvent(PCF85063AT_EVENT event, void *pUserData)
+{
+	PCF85063AT_timerwheel_t *pWheel = (PCF85063AT_timerwheel_t *)pUserData;
+
+	if ((pWheel == NULL) || (event != PCF85063AT_EVENT_TIMER))
+	{
+		return;
+	}
+
+	pWheel->lastStatus = PCF85063AT_Wheel_Process(pWheel);
+}
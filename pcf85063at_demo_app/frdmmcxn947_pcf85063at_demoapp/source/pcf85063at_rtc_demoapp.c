@@ -19,6 +19,8 @@
 #include "clock_config.h"
 #include "board.h"
 #include "fsl_debug_console.h"
+#include "fsl_lpuart.h"
+#include "fsl_port.h"
 #include "frdmmcxn947.h"
 
 //-----------------------------------------------------------------------
@@ -35,6 +37,8 @@
 #include "PCF85063AT.h"
 #include "Driver_GPIO.h"
 #include "pcf85063at_drv.h"
+#include "pcf85063at_events.h"
+#include "pcf85063at_bench.h"
 
 
 // Seize of RX/TX buffer
@@ -50,10 +54,6 @@ const registerwritelist_t PCF85063ATConfigDefault[] = {
 		/* generate a pulsed signal on MSF flag. */
 		__END_WRITE_DATA__};
 
-/*! @brief Address of Second Register for Time. */
-
-const registerreadlist_t PCF85063ATtimedata[] = {{.readFrom = PCF85063AT_SECOND, .numBytes = PCF85063AT_TIME_SIZE_BYTE}, __END_READ_DATA__};
-
 /*! @brief Address of Second Register for Alarm. */
 const registerreadlist_t PCF85063ATalarmdata[] = {{.readFrom = PCF85063AT_SECOND_ALARM, .numBytes = PCF85063AT_ALARM_TIME_SIZE_BYTE}, __END_READ_DATA__};
 
@@ -73,12 +73,24 @@ GENERIC_DRIVER_GPIO *pGpioDriver = &Driver_GPIO_KSDK;
 static gpioConfigKSDK_t gpioConfigDefault = {
 		.pinConfig = {kGPIO_DigitalInput, 1}, .portPinConfig = {0}, .interruptMode = kGPIO_InterruptFallingEdge};
 
+/*! @brief I/O context of the RTC bus. */
+static registerIoContext_t g_i2cContext;
+
+/*! @brief INTB events, dispatched from the main loop. */
+static PCF85063AT_eventdispatcher_t g_rtcEvents;
+
+/*! @brief Timer source clocks, indexed by TCF. */
+static const char *const s_timerClockName[] = {"4.096 kHz", "64 Hz", "1 Hz", "1/60 Hz"};
+
+/*! @brief PORT peripherals, indexed by port number. */
+static PORT_Type *const s_portBase[] = PORT_BASE_PTRS;
 
 void PCF85063AT_INTB_ISR(void)
 {
 	//Clear external interrupt flag.
 	GPIO_GpioClearInterruptFlags(INTB_PIN.base, 1U << INTB_PIN.pinNumber);
-	PRINTF("\r\n Interrupt Occurred on INTB Pin....Please Clear the interrupt\r\n");
+	/* Defer the flags to the main loop, no bus access or console output here */
+	PCF85063AT_Event_OnInterrupt(&g_rtcEvents);
 
 	SDK_ISR_EXIT_BARRIER;
 }
@@ -96,6 +108,37 @@ void init_PCF85063AT_wakeup_intB(void)
 }
 
 
+/*!@brief        Route the RTC bus pins for the bus recovery.
+ *  @details     With gpio true, SCL and SDA become open drain GPIO outputs released high, so that the recovery
+ *               pulses SCL without driving against a device holding SDA low. With gpio false, they return to
+ *               the I2C peripheral.
+ *  @param[in]   pParam   Unused.
+ *  @param[in]   gpio     Route the pins to the GPIO rather than to the I2C peripheral.
+ *  @constraints Set as the setPinMux of the bus recovery.
+ *  @reentrant   No
+ *  @return      void
+ */
+void setI2cPinMux(void *pParam, bool gpio)
+{
+	const port_pin_config_t gpioPinConfig = {.pullSelect = kPORT_PullUp, .slewRate = kPORT_FastSlewRate,
+			.openDrainEnable = kPORT_OpenDrainEnable, .mux = kPORT_MuxAlt0, .inputBuffer = kPORT_InputBufferEnable};
+	gpioConfigKSDK_t outputConfig = {.pinConfig = {kGPIO_DigitalOutput, 1}};
+
+	(void)pParam;
+	if (gpio != true)
+	{
+		RTE_I2C2_PIN_INIT();
+		return;
+	}
+
+	/* Outputs high before the PORT hands the pins over, no glitch on the bus */
+	pGpioDriver->pin_init(&PCF85063AT_SCL, GPIO_DIRECTION_OUT, &outputConfig, NULL, NULL);
+	pGpioDriver->pin_init(&PCF85063AT_SDA, GPIO_DIRECTION_OUT, &outputConfig, NULL, NULL);
+	PORT_SetPinConfig(s_portBase[PCF85063AT_SCL.portNumber], PCF85063AT_SCL.pinNumber, &gpioPinConfig);
+	PORT_SetPinConfig(s_portBase[PCF85063AT_SDA.portNumber], PCF85063AT_SDA.pinNumber, &gpioPinConfig);
+}
+
+
 /*!@brief        Print Alarm Time.
  *  @details     Print Alarm Time set by user.
  *  @param[in]   timeAlarm   Structure holding alarm data.
@@ -224,6 +267,44 @@ int32_t getAlarmType(void)
 	while(alarmmode < 0 || alarmmode > 5);
 }
 
+/*!@brief        RTC event handler.
+ *  @details     Print the event dispatched from INTB and its interrupt to handler latency.
+ *  @param[in]   event       Event which occurred.
+ *  @param[in]   pUserData   Unused.
+ *  @constraints None
+ *
+ *  @reentrant   No
+ *  @return      void
+ */
+void rtcEventHandler(PCF85063AT_EVENT event, void *pUserData)
+{
+	static const char *const eventName[PCF85063AT_EVENT_COUNT] = {"Alarm", "Minute", "Half Minute", "Countdown Timer"};
+	PCF85063AT_eventstats_t stats;
+
+	PCF85063AT_Event_GetStats(&g_rtcEvents, event, &stats);
+	PRINTF("\r\n %s interrupt occurred and cleared (count %d, latency %d ticks, max %d ticks)\r\n",
+			eventName[event], stats.count, stats.lastLatency, stats.maxLatency);
+}
+
+/*!@brief        Wait for a key on the debug console.
+ *  @details     Dispatch the INTB events while no key is received, so that they are handled when they occur
+ *               and their latency counters do not include the typing. The key stays in the UART for SCANF.
+ *  @param[in]   void
+ *  @constraints The debug console polls the UART, it has no receive interrupt.
+ *
+ *  @reentrant   No
+ *  @return      void
+ */
+void waitForKey(void)
+{
+	LPUART_Type *pUart = (LPUART_Type *)BOARD_DEBUG_UART_BASEADDR;
+
+	while (0U == (LPUART_GetStatusFlags(pUart) & (uint32_t)kLPUART_RxDataRegFullFlag))
+	{
+		PCF85063AT_Event_Process(&g_rtcEvents, false);
+	}
+}
+
 /*!@brief        Clear interrupts.
  *  @details     Clear interrupts (Seconds, Minute,Alarm).
  *  @param[in]   PCF85063ATDriver   Pointer to spi sensor handle structure.
@@ -234,47 +315,44 @@ int32_t getAlarmType(void)
  */
 int32_t clearInterrupts(PCF85063AT_sensorhandle_t *PCF85063ATDriver)
 {
-	IntState intstate;
 	int32_t status;
 
-	status = PCF85063AT_Check_MinHalfMinCTInt(PCF85063ATDriver, &intstate);
+	/* One read of Control_2, the handlers report and the flags are cleared in one write */
+	status = PCF85063AT_Event_Process(&g_rtcEvents, true);
 	if (SENSOR_ERROR_NONE != status)
 	{
-		PRINTF("\r\n Check Minutes or Half Minute Interrupt Failed\r\n");
+		PRINTF("\r\n Clear Interrupts Failed\r\n");
 		return ERROR;
 	}
-	if(intstate == 0x01)
-	{
-		PRINTF("\r\n Minutes, Half Minute or Countdown Timer interrupt occurred: %x \r\n", intstate);
-		status = PCF85063AT_Clear_MinHalfMinCTInt(PCF85063ATDriver);
-		if (SENSOR_ERROR_NONE != status)
-		{
-			PRINTF("\r\n Minutes, Half Minute or Countdown Timer Interrupt clear Failed\r\n");
-			return ERROR;
-		}
-		else
-			PRINTF("\r\n Minutes, Half Minute or Countdown Timer Interrupt cleared\r\n");
-	}
 
-	status = PCF85063AT_Check_AlarmInt(PCF85063ATDriver, &intstate );
+	return ERROR_NONE;
+}
+
+/*!@brief        Driver Benchmark.
+ *  @details     Measure every driver API and print the cost as comma separated values.
+ *  @param[in]   PCF85063ATDriver   Pointer to sensor handle structure, its shadow is dropped afterwards.
+ *  @constraints The configuration, alarm and time of the RTC are lost.
+ *
+ *  @reentrant   No
+ *  @return      Status of the operation.
+ */
+int32_t runBenchmark(PCF85063AT_sensorhandle_t *PCF85063ATDriver)
+{
+	static PCF85063AT_benchresult_t benchResults[PCF85063AT_BENCH_MAX_CASES];
+	uint32_t count = 0;
+	int32_t status;
+
+	status = PCF85063AT_Bench_Run(&I2C_S_DRIVER, I2C_S_DEVICE_INDEX, PCF85063AT_I2C_ADDR, benchResults, &count);
+	PCF85063AT_Bench_Print(benchResults, count);
+	/* The benchmark ends with a software reset through its own handle */
+	PCF85063AT_InvalidateShadow(PCF85063ATDriver);
 	if (SENSOR_ERROR_NONE != status)
 	{
-		PRINTF("\r\n Check Alarm Interrupt Failed\r\n");
+		PRINTF("\r\n Driver Benchmark Failed\r\n");
 		return ERROR;
 	}
-	if(intstate == 0x01)
-	{
-		PRINTF("\r\n Alarm Interrupt occurred: %x \r\n", intstate);
-		status = PCF85063AT_Clear_AlarmInt(PCF85063ATDriver);
-		if (SENSOR_ERROR_NONE != status)
-		{
-			PRINTF("\r\n Alarm Interrupt clear Failed\r\n");
-			return ERROR;
-		}
-		else
-			PRINTF("\r\n Alarm Interrupt cleared\r\n");
-	}
 
+	return ERROR_NONE;
 }
 
 /*!@brief        Set Alarm Time.
@@ -594,14 +672,19 @@ int32_t setTime(PCF85063AT_sensorhandle_t *PCF85063ATDriver, PCF85063AT_timedata
 int32_t getTime(PCF85063AT_sensorhandle_t *PCF85063ATDriver, PCF85063AT_timedata_t *timeData)
 {
 	int32_t status;
+	bool oscStopped;
 
-	/* Get Time */
-	status = PCF85063AT_GetTime(PCF85063ATDriver,(const registerreadlist_t *)&PCF85063ATtimedata , timeData);
+	/* Get Time, mode and oscillator stop flag in one burst */
+	status = PCF85063AT_GetTimeCoherent(PCF85063ATDriver, timeData, NULL, &oscStopped);
 	if (SENSOR_ERROR_NONE != status)
 	{
 		PRINTF("\r\n Get Time Failed\r\n");
 		return ERROR;
 	}
+	if (oscStopped)
+	{
+		PRINTF("\r\n Oscillator was stopped, clock integrity is not guaranteed. Set the time again.\r\n");
+	}
 	return ERROR_NONE;
 }
 
@@ -917,16 +1000,16 @@ void setmode12h_24h(PCF85063AT_sensorhandle_t *PCF85063ATDriver)
 
 int32_t SetTimerConfig(PCF85063AT_sensorhandle_t *PCF85063ATDriver){
 
-	float temp;
+	int32_t temp;
 	int32_t temp1;
 	int32_t temp2;
 	int32_t status;
-	int32_t CT_value;
+	PCF85063AT_timerplan_t plan;
 	IntState intstate;
 	TI_TP_State pTI_TPState;
 
 
-	PRINTF("\r\n 1. Choose Timer Clock Frequency \r\n");
+	PRINTF("\r\n 1. Set Timer Period \r\n");
 	PRINTF("\r\n 2. Set Timer Interrupt Mode \r\n");
 	PRINTF("\r\n 3. Enable/Disable Timer Interrupt \r\n");
 	PRINTF("\r\n 4. Start/Stop Timer \r\n");
@@ -942,86 +1025,33 @@ int32_t SetTimerConfig(PCF85063AT_sensorhandle_t *PCF85063ATDriver){
 
 	switch(temp2){
 
-	case 1: //To set the Timer Clock Frequency
-
-		PRINTF("\r\n Choose Timer Clock Frequency \r\n");
-		PRINTF("\r\n 1. 4.096 kHz (244 microSec - 62.256 ms) \r\n");
-		PRINTF("\r\n 2. 64 Hz (15.625 ms - 3.984 s) \r\n");
-		PRINTF("\r\n 3. 1 Hz (1 s - 255 s) \r\n");
-		PRINTF("\r\n 4. 1⁄60 Hz (60 s - 4 hr 15 min) \r\n");
+	case 1: //To set the Timer Clock Frequency and the countdown timer value
 
-		PRINTF("\r\n Enter your choice :- ");
+		PRINTF("\r\n Enter timer period in microseconds (244 - 2147483647) :- ");
 		do{
-			SCANF("%d",&temp1);
-			PRINTF("%d\r\n",temp1);
-			if(temp1 < 1 || temp1 > 4)
+			SCANF("%d",&temp);
+			PRINTF("%d\r\n",temp);
+			if(temp < 244)
 				PRINTF("\r\n Invalid Value, Please enter correct value\r\n");
 		}
-		while(temp1 < 1 || temp1 > 4);
-
-		status = PCF85063AT_SetTimerClockFreq(PCF85063ATDriver, temp1);
-
-		PRINTF("\r\n Timer Clock Frequency is Selected\r\n");
-
-		if(temp1==1){
-			PRINTF("\r\n Enter clock frequency value (0.000244-0.062256) :- ");
-			do{
-				SCANF("%f",&temp);
-				PRINTF("%f\r\n",temp);
-				if(temp < 0.000244 || temp > 0.062256)
-					PRINTF("\r\n Invalid Value, Please enter correct value\r\n");
-			}
-			while(temp < 0.000244 || temp > 0.062256);
-			// To find the countdown timer value
-			CT_value = (temp/0.000244);
-			status = PCF85063AT_Countdown_timer_value(PCF85063ATDriver, CT_value);
-
-			PRINTF("\r\n Timer for %f s is set\r\n ", temp);
-		}
-		if(temp1==2){
-			PRINTF("\r\n Enter clock frequency value (0.015625-3.984) :- ");
-			do{
-				SCANF("%f",&temp);
-				PRINTF("%f\r\n",temp);
-				if(temp < 0.015625 || temp > 3.984)
-					PRINTF("\r\n Invalid Value, Please enter correct value\r\n");
-			}
-			while(temp < 0.015625 || temp > 3.984);
-			// To find the countdown timer value
-			CT_value = (temp/0.015625);
-			status = PCF85063AT_Countdown_timer_value(PCF85063ATDriver, CT_value);
+		while(temp < 244);
 
-			PRINTF("\r\n Timer for %f s is set\r\n ", temp);
+		// Source clock and countdown timer value closest to the period
+		status = PCF85063AT_TimerPlan((uint64_t)temp, &plan);
+		if (SENSOR_ERROR_NONE == status)
+		{
+			status = PCF85063AT_TimerPlan_Apply(PCF85063ATDriver, &plan);
 		}
-		if(temp1==3){
-			PRINTF("\r\n Enter clock frequency value (1-255) :- ");
-			do{
-				SCANF("%f",&temp);
-				PRINTF("%f\r\n",temp);
-				if(temp < 1 || temp > 255)
-					PRINTF("\r\n Invalid Value, Please enter correct value\r\n");
-			}
-			while(temp < 1 || temp > 255);
-			// To find the countdown timer value
-			CT_value = (temp/1);
-			status = PCF85063AT_Countdown_timer_value(PCF85063ATDriver, CT_value);
-
-			PRINTF("\r\n Timer for %f s is set\r\n ", temp);
+		if (SENSOR_ERROR_NONE != status)
+		{
+			PRINTF("\r\n Timer setting is Failed\r\n");
 		}
-		if(temp1==4){
-			PRINTF("\r\n Enter clock frequency value (60-15300) :- ");
-			do{
-				SCANF("%f",&temp);
-				PRINTF("%f\r\n",temp);
-				if(temp < 60 || temp > 15300)
-					PRINTF("\r\n Invalid Value, Please enter correct value\r\n");
-			}
-			while(temp < 60 || temp > 15300);
-			// To find the countdown timer value
-			CT_value = (temp/60);
-			status = PCF85063AT_Countdown_timer_value(PCF85063ATDriver, CT_value);
-
-			PRINTF("\r\n Timer for %f s is set\r\n ", temp);
+		else
+		{
+			PRINTF("\r\n Timer Clock Frequency %s, countdown value %d\r\n", s_timerClockName[plan.tcf], plan.value);
+			// Periods past 2147 s do not fit a 32-bit count of microseconds, print seconds
+			PRINTF("\r\n Timer for %u.%06u s is set, error %d us\r\n ", (uint32_t)(plan.period_us / 1000000U),
+					(uint32_t)(plan.period_us % 1000000U), plan.error_us);
 		}
 
 	case 2: // To set Timer Interrupt Mode
@@ -1307,6 +1337,8 @@ int main(void)
 	uint8_t data[PCF85063AT_DATA_SIZE];
 	char dummy;
 	PCF85063AT_sensorhandle_t PCF85063ATDriver;
+	registerBusRecovery_t busRecovery = {.pGpioDrv = &Driver_GPIO_KSDK, .sclPin = &PCF85063AT_SCL,
+			.sdaPin = &PCF85063AT_SDA, .setPinMux = setI2cPinMux, .busSpeed = ARM_I2C_BUS_SPEED_FAST};
 
 	/* Enable EDMA for I2C */
 #if (RTE_I2C2_DMA_EN)
@@ -1335,8 +1367,8 @@ int main(void)
 	PRINTF("\r\n ISSDK PCF85063AT RTC driver example demonstration.\r\n");
 
 
-	/*! Initialize the driver. */
-	status = pdriver->Initialize(I2C_S_SIGNAL_EVENT);
+	/*! Initialize the driver, its events update g_i2cContext. */
+	status = Register_I2C_Initialize(pdriver, I2C_S_DEVICE_INDEX, &g_i2cContext);
 
 	if (ARM_DRIVER_OK != status)
 	{
@@ -1361,6 +1393,14 @@ int main(void)
 		return -1;
 	}
 
+	/*! When a transfer times out, clock SDA free on the GPIO and re-initialize the bus at this speed. */
+	status = Register_I2C_SetRecovery(I2C_S_DEVICE_INDEX, &busRecovery);
+	if (ARM_DRIVER_OK != status)
+	{
+		PRINTF("\r\n Bus Recovery setting Failed\r\n");
+		return -1;
+	}
+
 	/*! Initialize the PCF85063AT RTC driver. */
 	status = PCF85063AT_Initialize(&PCF85063ATDriver, &I2C_S_DRIVER, I2C_S_DEVICE_INDEX, PCF85063AT_I2C_ADDR);
 
@@ -1391,6 +1431,13 @@ int main(void)
 
 	PRINTF("\r\n PCF85063AT RTC Initial Software Reset completed \r\n");
 
+	/*! Dispatch INTB events from the main loop. */
+	PCF85063AT_Event_Init(&g_rtcEvents, &PCF85063ATDriver);
+	PCF85063AT_Event_Register(&g_rtcEvents, PCF85063AT_EVENT_ALARM, rtcEventHandler, NULL);
+	PCF85063AT_Event_Register(&g_rtcEvents, PCF85063AT_EVENT_MINUTE, rtcEventHandler, NULL);
+	PCF85063AT_Event_Register(&g_rtcEvents, PCF85063AT_EVENT_HALF_MINUTE, rtcEventHandler, NULL);
+	PCF85063AT_Event_Register(&g_rtcEvents, PCF85063AT_EVENT_TIMER, rtcEventHandler, NULL);
+
 	do
 	{
 		PRINTF("\r\n");
@@ -1409,10 +1456,13 @@ int main(void)
 		PRINTF("\r\n 12. Correction Interrupt \r\n");
 		PRINTF("\r\n 13. Set Offset/Correction Mode \r\n");
 		PRINTF("\r\n 14. Clear Interrupts\r\n");
-		PRINTF("\r\n 15. Exit \r\n");
+		PRINTF("\r\n 15. Driver Benchmark \r\n");
+		PRINTF("\r\n 16. Exit \r\n");
 		PRINTF("\r\n");
 
 		PRINTF("\r\n Enter your choice :- ");
+		/* Service INTB events until the choice is typed */
+		waitForKey();
 		SCANF("%d",&character);
 		PRINTF("%d\r\n",character);
 
@@ -1490,7 +1540,11 @@ int main(void)
 			PRINTF("\r\n Clearing Interrupts!!\r\n");
 			clearInterrupts(&PCF85063ATDriver);
 			break;
-		case 15:  /* Exit */
+		case 15:  /* Driver Benchmark */
+			PRINTF("\r\n Driver Benchmark, the RTC is software reset at the end!!\r\n");
+			runBenchmark(&PCF85063ATDriver);
+			break;
+		case 16:  /* Exit */
 			PRINTF("\r\n .....Bye\r\n");
 			exit(0);
 			break;
@@ -55,6 +55,49 @@ int32_t BOARD_SystickElapsedTicks(int32_t *pStart);
  */
 uint32_t BOARD_SystickElapsedTime_us(int32_t *pStart);
 
+/*! @brief       Function to get the free running systick count.
+ *  @details     This function returns the systicks elapsed since BOARD_SystickEnable(), counting up
+ *               and wrapping at 32 bits. Differences of two counts are valid across one wrap.
+ *  @param[in]   void.
+ *  @return      uint32_t The free running systick count.
+ *  @constraints None.
+ *  @reeentrant  Yes
+ */
+uint32_t BOARD_SystickGetTicks(void);
+
+/*! @brief       Function to get the 64 bit free running systick count.
+ *  @details     Same count as BOARD_SystickGetTicks() without the 32 bit wrap, for intervals
+ *               longer than 2^32 systicks (about 44 s at 96 MHz).
+ *  @param[in]   void.
+ *  @return      uint64_t The free running systick count.
+ *  @constraints None.
+ *  @reeentrant  Yes
+ */
+uint64_t BOARD_SystickGetTicks64(void);
+
+/*! @brief       Function to get the systicks to the next wrap.
+ *  @details     The SysTick interrupt at the wrap of its 24 bit counter, every 2^24 systicks, wakes the core
+ *               from a sleep which no other interrupt ends.
+ *  @param[in]   void.
+ *  @return      uint32_t The systicks until the SysTick interrupt, at most 2^24.
+ *  @constraints None.
+ *  @reeentrant  Yes
+ */
+uint32_t BOARD_SystickGetTicksToWrap(void);
+
+/*! @brief       Function to arm a wake-up on the SysTick interrupt.
+ *  @details     Shortens the period under way so that the SysTick interrupt comes within the given systicks,
+ *               unless the wrap comes first; the periods after it are full again. The count of
+ *               BOARD_SystickGetTicks() stays continuous within a few systicks per call. The interrupt ends a
+ *               __WFI(), and a __WFE() through the event it sends.
+ *  @param[in]   ticks The most systicks until the interrupt, 2 to 2^24.
+ *  @return      bool True when the SysTick interrupt comes within ticks, false when it cannot be armed, e.g.
+ *               when an RTOS owns the SysTick.
+ *  @constraints Interrupts are masked for a few cycles.
+ *  @reeentrant  No
+ */
+bool BOARD_SystickSetWakeup(uint32_t ticks);
+
 /*! @brief       Function to insert delays.
  *  @details     This function blocks for the specified milli seconds by using the elapsed systicks
  *               to determine time delays.
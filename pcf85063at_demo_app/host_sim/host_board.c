@@ -0,0 +1,112 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file host_board.c
+ * @brief The host_board.c file implements the board services used by the driver on the host:
+ *  the SysTick utilities on the virtual clock of the simulation and the global interrupt mask.
+ */
+
+#include "issdk_hal.h"
+#include "systick_utils.h"
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+I2C_Type g_HostI2c0;
+static uint32_t g_HostIrqMask;
+/* Count of the next SysTick interrupt, moved by BOARD_SystickSetWakeup(). */
+static uint64_t g_HostSystickIrq = 0x01000000U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+uint32_t DisableGlobalIRQ(void)
+{
+    uint32_t primask = g_HostIrqMask;
+
+    g_HostIrqMask = 1;
+
+    return primask;
+}
+
+void EnableGlobalIRQ(uint32_t primask)
+{
+    g_HostIrqMask = primask;
+}
+
+// The SysTick always runs on the host.
+void BOARD_SystickEnable(void)
+{
+    return;
+}
+
+uint64_t BOARD_SystickGetTicks64(void)
+{
+    uint64_t ns = PCF85063AT_Sim_GetTimeNs();
+
+    // Split to stay within 64 bits for centuries of virtual time.
+    return (ns / 1000000000U) * PCF85063AT_SIM_CORE_CLOCK_HZ +
+           (ns % 1000000000U) * PCF85063AT_SIM_CORE_CLOCK_HZ / 1000000000U;
+}
+
+uint32_t BOARD_SystickGetTicks(void)
+{
+    return (uint32_t)BOARD_SystickGetTicks64();
+}
+
+// A 24 bit SysTick counter is modelled for its interrupt, full periods follow the last one.
+uint32_t BOARD_SystickGetTicksToWrap(void)
+{
+    uint64_t now = BOARD_SystickGetTicks64();
+
+    if (g_HostSystickIrq <= now)
+    {
+        g_HostSystickIrq += ((now - g_HostSystickIrq) / 0x01000000U + 1U) * 0x01000000U;
+    }
+
+    return (uint32_t)(g_HostSystickIrq - now);
+}
+
+bool BOARD_SystickSetWakeup(uint32_t ticks)
+{
+    if ((ticks < 2U) || (ticks > 0x01000000U))
+    {
+        return false;
+    }
+    if (ticks < BOARD_SystickGetTicksToWrap())
+    {
+        g_HostSystickIrq = BOARD_SystickGetTicks64() + ticks;
+    }
+
+    return true;
+}
+
+void BOARD_SystickStart(int32_t *pStart)
+{
+    *pStart = (int32_t)BOARD_SystickGetTicks();
+}
+
+int32_t BOARD_SystickElapsedTicks(int32_t *pStart)
+{
+    return (int32_t)(BOARD_SystickGetTicks() - (uint32_t)*pStart);
+}
+
+uint32_t BOARD_SystickElapsedTime_us(int32_t *pStart)
+{
+    uint32_t elapsed = (uint32_t)BOARD_SystickElapsedTicks(pStart);
+
+    BOARD_SystickStart(pStart);
+
+    return (uint32_t)COUNT_TO_USEC(elapsed, PCF85063AT_SIM_CORE_CLOCK_HZ);
+}
+
+// Delays move the virtual clock, signalling the events which fall due meanwhile.
+void BOARD_DELAY_ms(uint32_t delay_ms)
+{
+    PCF85063AT_Sim_Advance((uint64_t)delay_ms * 1000000U);
+}
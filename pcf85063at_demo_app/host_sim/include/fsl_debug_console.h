@@ -0,0 +1,23 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file fsl_debug_console.h
+ * @brief The fsl_debug_console.h file is the host replacement of the debug console, on stdio.
+ */
+
+#ifndef _FSL_DEBUGCONSOLE_H_
+#define _FSL_DEBUGCONSOLE_H_
+
+#include <stdio.h>
+
+#define PRINTF  printf
+#define SCANF   scanf
+#define PUTCHAR putchar
+#define GETCHAR getchar
+
+#endif /* _FSL_DEBUGCONSOLE_H_ */
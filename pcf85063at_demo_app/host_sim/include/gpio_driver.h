@@ -0,0 +1,20 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file gpio_driver.h
+ * @brief The gpio_driver.h file is the host replacement of the GPIO driver. INTB is delivered by
+ *  PCF85063AT_Sim_SetIntbCallback() instead of a pin interrupt.
+ */
+
+#ifndef __DRIVER_GPIO_H__
+#define __DRIVER_GPIO_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#endif /* __DRIVER_GPIO_H__ */
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file issdk_hal.h
+ * @brief The issdk_hal.h file is the host replacement of the board HAL: one I2C bus, I2C0, with the
+ *  simulated PCF85063AT on it.
+ */
+
+#ifndef __ISSDK_HAL_H__
+#define __ISSDK_HAL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Driver_I2C.h"
+#include "pcf85063at_sim.h"
+
+/* The I2C instance seen by register_io_i2c.c, only its count and its index matter. */
+typedef struct
+{
+    uint32_t reserved;
+} I2C_Type;
+extern I2C_Type g_HostI2c0;
+#define I2C0          (&g_HostI2c0)
+#define I2C_BASE_PTRS {I2C0}
+
+#define I2C_S_DRIVER       Driver_I2C_Sim
+#define I2C_S_DEVICE_INDEX I2C0_INDEX
+#define I2C_S_SIGNAL_EVENT I2C0_SignalEvent_t
+#define PCF85063AT_I2C_ADDR PCF85063AT_SIM_I2C_ADDR
+
+/* Busy waits and sleeps move the virtual clock, see PCF85063AT_Sim_Idle() and PCF85063AT_Sim_Sleep(). */
+#define __NOP() PCF85063AT_Sim_Idle()
+#define __WFI() PCF85063AT_Sim_Sleep()
+#define __WFE() PCF85063AT_Sim_Sleep()
+#define __SEV()
+#define __DSB()
+#define __ISB()
+
+/* The simulation signals events from the thread which moves the virtual clock, masking only nests. */
+uint32_t DisableGlobalIRQ(void);
+void EnableGlobalIRQ(uint32_t primask);
+
+#define kCLOCK_CoreSysClk (0)
+#define CLOCK_GetFreq(clock) (PCF85063AT_SIM_CORE_CLOCK_HZ)
+#define COUNT_TO_USEC(count, clockFreqInHz) (uint64_t)(((uint64_t)(count)*1000000U) / (clockFreqInHz))
+#define COUNT_TO_MSEC(count, clockFreqInHz) (uint64_t)((uint64_t)(count)*1000U / (clockFreqInHz))
+
+#endif /* __ISSDK_HAL_H__ */
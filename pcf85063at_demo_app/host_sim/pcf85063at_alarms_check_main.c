@@ -0,0 +1,244 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_alarms_check_main.c
+ * @brief The pcf85063at_alarms_check_main.c file checks the alarm scheduler of pcf85063at_alarms.c on the host
+ *  simulation, with the alarm of the simulated device raising INTB.
+
+    Usage: pcf85063at_alarms_check
+
+    Checks that the heap keeps its order and the slots their positions through inserts and through cancels of
+    alarms below the root, both those moving the last alarm up and those moving it down; that the alarms fire
+    in deadline order within a second of their deadline and cancelled ones never; that a deadline reached
+    before the hardware alarm is programmed, at the insert or while a callback runs, still fires; and that a
+    deadline a month away matching the hardware alarm early fires nothing and is counted in earlyMatches.
+    Prints "check,<alarms>,alarms" and exits with 0, or prints a FAIL line and exits with 1.
+
+    Build as in pcf85063at_sim.h, with this file as the application.
+*/
+
+/* Standard C Includes */
+#include <stdio.h>
+
+/* ISSDK Includes */
+#include "issdk_hal.h"
+#include "pcf85063at_alarms.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! The step of the main loop, in nanoseconds. */
+#define ALARMS_CHECK_STEP_NS (100000000U)
+/*! 2024-01-01 00:00:00, the start of the check. */
+#define ALARMS_CHECK_START (1704067200U)
+/*! 2026-02-01 11:59:50, a Sunday, and 2026-03-01 12:00:00, a Sunday too: day, weekday and time match. */
+#define ALARMS_CHECK_EARLY_START (1769947190U)
+#define ALARMS_CHECK_EARLY_EPOCH (1772366400U)
+/*! Alarms inserted at random. */
+#define ALARMS_CHECK_RANDOM (24U)
+
+#define ALARMS_CHECK(cond)                                                     \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            printf("FAIL,%s:%d,%s\n", __FILE__, __LINE__, #cond);             \
+            return 1;                                                          \
+        }                                                                      \
+    } while (0)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static PCF85063AT_sensorhandle_t g_Rtc;
+static PCF85063AT_eventdispatcher_t g_Events;
+static PCF85063AT_alarmscheduler_t g_Alarms;
+
+/*! Set by the callbacks, which cannot return a failure. */
+static uint32_t g_Failures;
+static uint32_t g_Fired;
+static uint32_t g_LastEpoch;
+static uint32_t g_Scheduled;
+static bool g_Cancelled[PCF85063AT_ALARM_POOL_SIZE];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void Alarms_Callback(uint8_t id, uint32_t epoch, void *pUserData)
+{
+    uint32_t now;
+
+    (void)pUserData;
+    if ((PCF85063AT_GetEpoch(&g_Rtc, &now) != SENSOR_ERROR_NONE) || (epoch > now) || (now - epoch > 1U) ||
+        (epoch < g_LastEpoch) || g_Cancelled[id])
+    {
+        printf("FAIL,alarm %u,epoch %u fired at %u after %u\n", (unsigned)id, (unsigned)epoch, (unsigned)now,
+               (unsigned)g_LastEpoch);
+        g_Failures++;
+    }
+    g_LastEpoch = epoch;
+    g_Fired++;
+}
+
+/* Inserts an alarm two seconds ahead, then lets the second pass before the hardware alarm is programmed. */
+static void Alarms_LateCallback(uint8_t id, uint32_t epoch, void *pUserData)
+{
+    Alarms_Callback(id, epoch, pUserData);
+    if (PCF85063AT_Alarms_Insert(&g_Alarms, epoch + 2U, Alarms_Callback, NULL, NULL) != SENSOR_ERROR_NONE)
+    {
+        g_Failures++;
+    }
+    PCF85063AT_Sim_Advance(3000000000ULL);
+}
+
+static void Alarms_Intb(void *pUserData)
+{
+    (void)pUserData;
+    PCF85063AT_Event_OnInterrupt(&g_Events);
+}
+
+/* Check the heap order, the slot positions and the hardware alarm following the root. */
+static int Alarms_CheckHeap(void)
+{
+    uint32_t i, epoch;
+
+    for (i = 0; i < g_Alarms.count; i++)
+    {
+        ALARMS_CHECK(g_Alarms.slot[g_Alarms.heap[i]].heapIndex == i);
+        ALARMS_CHECK((i == 0) || (g_Alarms.slot[g_Alarms.heap[(i - 1U) / 2U]].epoch <=
+                                  g_Alarms.slot[g_Alarms.heap[i]].epoch));
+    }
+    if (g_Alarms.count != 0)
+    {
+        ALARMS_CHECK(PCF85063AT_Alarms_GetNext(&g_Alarms, &epoch) == SENSOR_ERROR_NONE);
+        ALARMS_CHECK(epoch == g_Alarms.slot[g_Alarms.heap[0]].epoch);
+        ALARMS_CHECK(g_Alarms.armed && g_Alarms.armedEpoch == epoch);
+    }
+    else
+    {
+        ALARMS_CHECK(PCF85063AT_Alarms_GetNext(&g_Alarms, &epoch) == SENSOR_ERROR_INIT);
+        ALARMS_CHECK(!g_Alarms.armed);
+    }
+
+    return 0;
+}
+
+/* Insert an alarm firing Alarms_Callback and check the heap. */
+static int Alarms_Insert(uint32_t epoch, uint8_t *pId)
+{
+    ALARMS_CHECK(PCF85063AT_Alarms_Insert(&g_Alarms, epoch, Alarms_Callback, NULL, pId) == SENSOR_ERROR_NONE);
+    g_Cancelled[*pId] = false;
+    g_Scheduled++;
+
+    return Alarms_CheckHeap();
+}
+
+/* Cancel an alarm, which must never fire, and check the heap. */
+static int Alarms_Cancel(uint8_t id)
+{
+    ALARMS_CHECK(PCF85063AT_Alarms_Cancel(&g_Alarms, id) == SENSOR_ERROR_NONE);
+    g_Cancelled[id] = true;
+    g_Scheduled--;
+
+    return Alarms_CheckHeap();
+}
+
+/* Move the virtual clock for the seconds given, dispatching the INTB events. */
+static int Alarms_Run(uint32_t seconds)
+{
+    uint32_t steps;
+
+    for (steps = 0; steps < seconds * (1000000000U / ALARMS_CHECK_STEP_NS); steps++)
+    {
+        PCF85063AT_Sim_Advance(ALARMS_CHECK_STEP_NS);
+        ALARMS_CHECK(PCF85063AT_Event_Process(&g_Events, false) == SENSOR_ERROR_NONE);
+        ALARMS_CHECK(g_Alarms.lastStatus == SENSOR_ERROR_NONE);
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    /*! Each one at least its parent, so inserted in this order they stay at these heap positions. */
+    static const uint32_t heapOrder[] = {10, 100, 20, 110, 120, 30, 40};
+    uint8_t id[PCF85063AT_ALARM_POOL_SIZE];
+    uint32_t i, now, random = 12345U, fired;
+
+    PCF85063AT_Sim_Init(PCF85063AT_SIM_COMPLETE_IMMEDIATE);
+    ALARMS_CHECK(Register_I2C_Initialize(&I2C_S_DRIVER, I2C_S_DEVICE_INDEX, NULL) == ARM_DRIVER_OK);
+    ALARMS_CHECK(I2C_S_DRIVER.PowerControl(ARM_POWER_FULL) == ARM_DRIVER_OK);
+    ALARMS_CHECK(PCF85063AT_Initialize(&g_Rtc, &I2C_S_DRIVER, I2C_S_DEVICE_INDEX, PCF85063AT_I2C_ADDR) ==
+                 SENSOR_ERROR_NONE);
+    ALARMS_CHECK(PCF85063AT_SetEpoch(&g_Rtc, ALARMS_CHECK_START) == SENSOR_ERROR_NONE);
+    ALARMS_CHECK(PCF85063AT_Event_Init(&g_Events, &g_Rtc) == SENSOR_ERROR_NONE);
+    ALARMS_CHECK(PCF85063AT_Event_Register(&g_Events, PCF85063AT_EVENT_ALARM, PCF85063AT_Alarms_OnEvent,
+                                           &g_Alarms) == SENSOR_ERROR_NONE);
+    PCF85063AT_Sim_SetIntbCallback(Alarms_Intb, NULL);
+    ALARMS_CHECK(PCF85063AT_Alarms_Init(&g_Alarms, &g_Rtc) == SENSOR_ERROR_NONE);
+    ALARMS_CHECK(Alarms_CheckHeap() == 0);
+
+    /*! Cancels below the root: the last alarm moves up into position 3, then down from position 1. */
+    for (i = 0; i < sizeof(heapOrder) / sizeof(heapOrder[0]); i++)
+    {
+        ALARMS_CHECK(Alarms_Insert(ALARMS_CHECK_START + heapOrder[i], &id[i]) == 0);
+        ALARMS_CHECK(g_Alarms.slot[id[i]].heapIndex == i);
+    }
+    ALARMS_CHECK(Alarms_Cancel(id[3]) == 0);
+    ALARMS_CHECK(g_Alarms.slot[id[6]].heapIndex == 1 && g_Alarms.slot[id[1]].heapIndex == 3);
+    ALARMS_CHECK(Alarms_Insert(ALARMS_CHECK_START + 200U, &id[3]) == 0);
+    ALARMS_CHECK(g_Alarms.slot[id[3]].heapIndex == 6);
+    ALARMS_CHECK(Alarms_Cancel(id[6]) == 0);
+    ALARMS_CHECK(g_Alarms.slot[id[1]].heapIndex == 1 && g_Alarms.slot[id[3]].heapIndex == 3);
+    ALARMS_CHECK(PCF85063AT_Alarms_Cancel(&g_Alarms, id[6]) == SENSOR_ERROR_INVALID_PARAM);
+
+    /*! Random deadlines, some equal, and cancels anywhere in the heap. */
+    for (i = 0; i < ALARMS_CHECK_RANDOM; i++)
+    {
+        random = random * 1103515245U + 12345U;
+        ALARMS_CHECK(Alarms_Insert(ALARMS_CHECK_START + 5U + (random >> 16) % 150U, &id[i]) == 0);
+    }
+    for (i = 0; i < ALARMS_CHECK_RANDOM; i += 5)
+    {
+        ALARMS_CHECK(Alarms_Cancel(id[i]) == 0);
+    }
+    ALARMS_CHECK(g_Alarms.count == g_Scheduled);
+
+    ALARMS_CHECK(Alarms_Run(210) == 0);
+    ALARMS_CHECK(g_Failures == 0 && g_Fired == g_Scheduled);
+    ALARMS_CHECK(Alarms_CheckHeap() == 0 && g_Alarms.count == 0);
+
+    /*! Missed at the insert: a deadline reached fires before the insert returns. */
+    ALARMS_CHECK(PCF85063AT_GetEpoch(&g_Rtc, &now) == SENSOR_ERROR_NONE);
+    fired = g_Fired;
+    ALARMS_CHECK(PCF85063AT_Alarms_Insert(&g_Alarms, now, Alarms_Callback, NULL, NULL) == SENSOR_ERROR_NONE);
+    ALARMS_CHECK(g_Fired == fired + 1U && Alarms_CheckHeap() == 0);
+
+    /*! Missed while processing: the deadline inserted by the callback passes before the alarm is programmed. */
+    g_LastEpoch = 0;
+    ALARMS_CHECK(PCF85063AT_Alarms_Insert(&g_Alarms, now + 2U, Alarms_LateCallback, NULL, NULL) ==
+                 SENSOR_ERROR_NONE);
+    ALARMS_CHECK(Alarms_Run(3) == 0);
+    ALARMS_CHECK(g_Failures == 0 && g_Fired == fired + 3U && Alarms_CheckHeap() == 0);
+    ALARMS_CHECK(g_Alarms.earlyMatches == 0);
+
+    /*! Early match: a month ahead, the day, weekday and time match in four weeks. */
+    ALARMS_CHECK(PCF85063AT_SetEpoch(&g_Rtc, ALARMS_CHECK_EARLY_START) == SENSOR_ERROR_NONE);
+    ALARMS_CHECK(PCF85063AT_Alarms_Insert(&g_Alarms, ALARMS_CHECK_EARLY_EPOCH, Alarms_Callback, NULL, NULL) ==
+                 SENSOR_ERROR_NONE);
+    ALARMS_CHECK(Alarms_Run(20) == 0);
+    ALARMS_CHECK(g_Alarms.earlyMatches == 1 && g_Alarms.count == 1 && Alarms_CheckHeap() == 0);
+    ALARMS_CHECK(PCF85063AT_SetEpoch(&g_Rtc, ALARMS_CHECK_EARLY_EPOCH - 10U) == SENSOR_ERROR_NONE);
+    ALARMS_CHECK(Alarms_Run(20) == 0);
+    ALARMS_CHECK(g_Failures == 0 && g_Fired == fired + 4U && g_Alarms.earlyMatches == 1);
+    ALARMS_CHECK(Alarms_CheckHeap() == 0);
+
+    printf("check,%u,alarms\n", (unsigned)g_Fired);
+
+    return 0;
+}
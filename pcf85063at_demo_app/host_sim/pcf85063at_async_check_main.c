@@ -0,0 +1,209 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_async_check_main.c
+ * @brief The pcf85063at_async_check_main.c file checks PCF85063AT_GetTimeAsync() and PCF85063AT_SetTimeAsync()
+ *  on the host simulation, with the transfers completed from a simulated interrupt.
+
+    Usage: pcf85063at_async_check
+
+    The transfer events are deferred: they are signalled when the main loop moves the virtual clock by one
+    tick, as the I2C interrupt would preempt it on the target. Each request is checked to return before its
+    transfer ends, to report its status and data through the callback only, and to keep the bus: a second
+    request meanwhile gets SENSOR_ERROR_BUSY from the driver and ARM_DRIVER_ERROR_BUSY from the register
+    interface, while a blocking call waits for the callback. Prints "check,<requests>,requests" and exits
+    with 0, or prints a FAIL line and exits with 1.
+
+    Build as in pcf85063at_sim.h, with this file as the application.
+*/
+
+/* Standard C Includes */
+#include <stdio.h>
+#include <string.h>
+
+/* ISSDK Includes */
+#include "issdk_hal.h"
+#include "pcf85063at_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! The period of the simulated interrupt tick, in nanoseconds. */
+#define ASYNC_CHECK_TICK_NS (10000U)
+/*! The most ticks a request may take, 10 ms. */
+#define ASYNC_CHECK_MAX_TICKS (1000U)
+
+#define ASYNC_CHECK(cond)                                                      \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            printf("FAIL,%s:%d,%s\n", __FILE__, __LINE__, #cond);             \
+            return 1;                                                          \
+        }                                                                      \
+    } while (0)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static PCF85063AT_sensorhandle_t g_Rtc;
+static PCF85063AT_sensorhandle_t g_OtherRtc;
+static const registerreadlist_t g_TimeRegisters[] = {{.readFrom = PCF85063AT_SECOND, .numBytes = 7},
+                                                     __END_READ_DATA__};
+
+/*! Written by the callback, from the simulated interrupt. */
+static volatile uint32_t g_Calls;
+static volatile int32_t g_Status;
+static void *volatile g_UserData;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void Async_Callback(void *pUserData, int32_t status)
+{
+    g_UserData = pUserData;
+    g_Status = status;
+    g_Calls++;
+}
+
+/* Tick the virtual clock until the callback has run, return the ticks or 0 on a timeout. */
+static uint32_t Async_Complete(void)
+{
+    uint32_t ticks;
+
+    for (ticks = 1; ticks <= ASYNC_CHECK_MAX_TICKS; ticks++)
+    {
+        PCF85063AT_Sim_Advance(ASYNC_CHECK_TICK_NS);
+        if (g_Calls != 0)
+        {
+            return ticks;
+        }
+    }
+
+    return 0;
+}
+
+static bool Async_Same(const PCF85063AT_timedata_t *a, const PCF85063AT_timedata_t *b)
+{
+    return a->second == b->second && a->minutes == b->minutes && a->hours == b->hours && a->days == b->days &&
+           a->weekdays == b->weekdays && a->months == b->months && a->years == b->years && a->ampm == b->ampm;
+}
+
+/* Check that every other asynchronous request on the bus is refused while a request of g_Rtc is pending. */
+static int Async_CheckBusy(void)
+{
+    static registerAsyncTransfer_t other;
+    PCF85063AT_timedata_t time;
+    uint8_t value;
+
+    ASYNC_CHECK(PCF85063AT_GetTimeAsync(&g_Rtc, &time, Async_Callback, NULL) == SENSOR_ERROR_BUSY);
+    ASYNC_CHECK(PCF85063AT_SetTimeAsync(&g_Rtc, &time, Async_Callback, NULL) == SENSOR_ERROR_BUSY);
+    ASYNC_CHECK(PCF85063AT_GetTimeAsync(&g_OtherRtc, &time, Async_Callback, NULL) == SENSOR_ERROR_BUSY);
+    ASYNC_CHECK(Register_I2C_ReadAsync(&I2C_S_DRIVER, &g_OtherRtc.deviceInfo, PCF85063AT_I2C_ADDR, PCF85063AT_SECOND,
+                                       1, &value, &other, NULL, NULL) == ARM_DRIVER_ERROR_BUSY);
+    ASYNC_CHECK(g_Calls == 0);
+
+    return 0;
+}
+
+int main(void)
+{
+    PCF85063AT_timedata_t set = {.second = 56, .minutes = 34, .hours = 7, .days = 29, .weekdays = 4,
+                                 .months = 2, .years = 24, .ampm = PM};
+    PCF85063AT_timedata_t got, blocking;
+    PCF85063AT_timeframe_t frame;
+    uint32_t requests = 0;
+    int mode;
+
+    PCF85063AT_Sim_Init(PCF85063AT_SIM_COMPLETE_DEFERRED);
+    ASYNC_CHECK(Register_I2C_Initialize(&I2C_S_DRIVER, I2C_S_DEVICE_INDEX, NULL) == ARM_DRIVER_OK);
+    ASYNC_CHECK(I2C_S_DRIVER.PowerControl(ARM_POWER_FULL) == ARM_DRIVER_OK);
+    ASYNC_CHECK(PCF85063AT_Initialize(&g_Rtc, &I2C_S_DRIVER, I2C_S_DEVICE_INDEX, PCF85063AT_I2C_ADDR) ==
+                SENSOR_ERROR_NONE);
+    ASYNC_CHECK(PCF85063AT_Initialize(&g_OtherRtc, &I2C_S_DRIVER, I2C_S_DEVICE_INDEX, PCF85063AT_I2C_ADDR) ==
+                SENSOR_ERROR_NONE);
+
+    for (mode = mode24H; mode <= mode12H; mode++)
+    {
+        /*! The hour mode is taken from Control_1 by the read. */
+        ASYNC_CHECK(PCF85063AT_12h_24h_Mode_Set(&g_Rtc, (Mode12h_24h)mode) == SENSOR_ERROR_NONE);
+        set.ampm = (mode == mode24H) ? h24 : PM;
+        set.hours = (mode == mode24H) ? 19 : 7;
+        set.minutes = (mode == mode24H) ? 34 : 43;
+        ASYNC_CHECK(PCF85063AT_TimeToBcd(&set, &frame) == SENSOR_ERROR_NONE);
+
+        /*! SetTimeAsync: time is encoded before the call returns, the callback runs on the tick which ends the
+         *  transfer. */
+        g_Calls = 0;
+        ASYNC_CHECK(PCF85063AT_SetTimeAsync(&g_Rtc, &set, Async_Callback, &g_Rtc) == SENSOR_ERROR_NONE);
+        memset(&set, 0xFF, sizeof(set));
+        ASYNC_CHECK(g_Calls == 0);
+        if (Async_CheckBusy())
+        {
+            return 1;
+        }
+        ASYNC_CHECK(Async_Complete() > 1);
+        ASYNC_CHECK(g_Calls == 1 && g_Status == SENSOR_ERROR_NONE && g_UserData == &g_Rtc);
+        ASYNC_CHECK(PCF85063AT_Sim_PeekRegister(PCF85063AT_MINUTE) == frame.minutes);
+        ASYNC_CHECK(PCF85063AT_Sim_PeekRegister(PCF85063AT_HOUR) == frame.hours);
+        ASYNC_CHECK(PCF85063AT_Sim_PeekRegister(PCF85063AT_YEAR) == frame.years);
+        ASYNC_CHECK(PCF85063AT_BcdToTime(&frame, (Mode12h_24h)mode, &set) == SENSOR_ERROR_NONE);
+        requests++;
+
+        /*! GetTimeAsync: time is written before the callback and matches a blocking read. */
+        g_Calls = 0;
+        memset(&got, 0xFF, sizeof(got));
+        ASYNC_CHECK(PCF85063AT_GetTimeAsync(&g_Rtc, &got, Async_Callback, &got) == SENSOR_ERROR_NONE);
+        ASYNC_CHECK(g_Calls == 0);
+        if (Async_CheckBusy())
+        {
+            return 1;
+        }
+        ASYNC_CHECK(Async_Complete() > 1);
+        ASYNC_CHECK(g_Calls == 1 && g_Status == SENSOR_ERROR_NONE && g_UserData == &got);
+        ASYNC_CHECK(Async_Same(&got, &set));
+        ASYNC_CHECK(PCF85063AT_GetTime(&g_Rtc, g_TimeRegisters, &blocking) == SENSOR_ERROR_NONE);
+        ASYNC_CHECK(Async_Same(&got, &blocking));
+        requests++;
+    }
+
+    /*! A failed transfer is reported through the callback, and frees the bus for the next request. */
+    g_Calls = 0;
+    PCF85063AT_Sim_InjectFault(1, ARM_I2C_EVENT_ADDRESS_NACK);
+    ASYNC_CHECK(PCF85063AT_GetTimeAsync(&g_Rtc, &got, Async_Callback, NULL) == SENSOR_ERROR_NONE);
+    ASYNC_CHECK(Async_Complete() != 0);
+    ASYNC_CHECK(g_Calls == 1 && g_Status == SENSOR_ERROR_READ);
+    requests++;
+
+    g_Calls = 0;
+    PCF85063AT_Sim_InjectFault(1, ARM_I2C_EVENT_ADDRESS_NACK);
+    ASYNC_CHECK(PCF85063AT_SetTimeAsync(&g_Rtc, &set, Async_Callback, NULL) == SENSOR_ERROR_NONE);
+    ASYNC_CHECK(Async_Complete() != 0);
+    ASYNC_CHECK(g_Calls == 1 && g_Status == SENSOR_ERROR_WRITE);
+    requests++;
+
+    g_Calls = 0;
+    ASYNC_CHECK(PCF85063AT_GetTimeAsync(&g_OtherRtc, &got, Async_Callback, NULL) == SENSOR_ERROR_NONE);
+    ASYNC_CHECK(Async_Complete() > 1);
+    ASYNC_CHECK(g_Calls == 1 && g_Status == SENSOR_ERROR_NONE && Async_Same(&got, &set));
+    requests++;
+
+    /*! A blocking call meanwhile waits for the pending request, whose callback has run when it returns. */
+    g_Calls = 0;
+    memset(&got, 0xFF, sizeof(got));
+    ASYNC_CHECK(PCF85063AT_GetTimeAsync(&g_Rtc, &got, Async_Callback, NULL) == SENSOR_ERROR_NONE);
+    ASYNC_CHECK(g_Calls == 0);
+    ASYNC_CHECK(PCF85063AT_GetTime(&g_OtherRtc, g_TimeRegisters, &blocking) == SENSOR_ERROR_NONE);
+    ASYNC_CHECK(g_Calls == 1 && g_Status == SENSOR_ERROR_NONE && Async_Same(&got, &set));
+    ASYNC_CHECK(Async_Same(&blocking, &set));
+    requests++;
+
+    printf("check,%u,requests\n", (unsigned)requests);
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_bench_main.c
+ * @brief The pcf85063at_bench_main.c file runs the driver micro benchmark on the host simulation and
+ *  checks it against a budget file.
+
+    Usage: pcf85063at_bench [-w wake_ns] [budget.csv]
+
+    Prints the results as comma separated values. With a budget file, also prints a FAIL line per API
+    over budget and exits with 1. The budget file has one "api,transactions,bytes" line per API, lines
+    starting with '#' and the "api,..." header are skipped, see pcf85063at_bench_budget.csv.
+
+    -w charges wake_ns nanoseconds each time a wait loop is woken by a transfer event, see
+    PCF85063AT_Sim_SetWakeLatency(), so that time_us shows the cost of the interrupt to thread handoffs.
+
+    Build as in pcf85063at_sim.h, with $P/rtc/pcf85063at_bench.c and this file as the application.
+*/
+
+/* Standard C Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ISSDK Includes */
+#include "issdk_hal.h"
+#include "pcf85063at_bench.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_BUDGET_MAX_LINES (PCF85063AT_BENCH_MAX_CASES)
+#define BENCH_BUDGET_NAME_SIZE (32)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static char g_BudgetNames[BENCH_BUDGET_MAX_LINES][BENCH_BUDGET_NAME_SIZE];
+static PCF85063AT_benchbudget_t g_Budget[BENCH_BUDGET_MAX_LINES];
+static PCF85063AT_benchresult_t g_Results[PCF85063AT_BENCH_MAX_CASES];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Read the budget file, return the number of entries or -1. */
+static int Bench_LoadBudget(const char *pPath)
+{
+    char line[128];
+    unsigned transactions, bytes;
+    int count = 0;
+    FILE *pFile = fopen(pPath, "r");
+
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", pPath);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), pFile) != NULL)
+    {
+        if ((line[0] == '#') || (line[0] == '\n') || (line[0] == '\r') || (strncmp(line, "api,", 4) == 0))
+        {
+            continue;
+        }
+        if (count >= BENCH_BUDGET_MAX_LINES)
+        {
+            fprintf(stderr, "%s: more than %d entries\n", pPath, BENCH_BUDGET_MAX_LINES);
+            break;
+        }
+        if (sscanf(line, "%31[^,],%u,%u", g_BudgetNames[count], &transactions, &bytes) != 3)
+        {
+            fprintf(stderr, "%s: bad line: %s", pPath, line);
+            fclose(pFile);
+            return -1;
+        }
+        g_Budget[count].name = g_BudgetNames[count];
+        g_Budget[count].transactions = transactions;
+        g_Budget[count].bytes = bytes;
+        count++;
+    }
+
+    fclose(pFile);
+    return count;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t count, regressions;
+    int32_t status;
+    int budgetCount = 0;
+    uint32_t wakeNs = 0;
+
+    if ((argc > 2) && (strcmp(argv[1], "-w") == 0))
+    {
+        wakeNs = (uint32_t)strtoul(argv[2], NULL, 0);
+        argc -= 2;
+        argv += 2;
+    }
+    if ((argc > 1) && ((budgetCount = Bench_LoadBudget(argv[1])) < 0))
+    {
+        return 2;
+    }
+
+    /*! Deferred completion, so that the wait loops spin for the wire time as on the target. */
+    PCF85063AT_Sim_Init(PCF85063AT_SIM_COMPLETE_DEFERRED);
+    PCF85063AT_Sim_SetWakeLatency(wakeNs);
+    I2C_S_DRIVER.Initialize(I2C_S_SIGNAL_EVENT);
+    I2C_S_DRIVER.PowerControl(ARM_POWER_FULL);
+    I2C_S_DRIVER.Control(ARM_I2C_BUS_SPEED, ARM_I2C_BUS_SPEED_FAST);
+
+    status = PCF85063AT_Bench_Run(&I2C_S_DRIVER, I2C_S_DEVICE_INDEX, PCF85063AT_I2C_ADDR, g_Results, &count);
+    PCF85063AT_Bench_Print(g_Results, count);
+    if (SENSOR_ERROR_NONE != status)
+    {
+        fprintf(stderr, "benchmark failed: %d\n", (int)status);
+        return 2;
+    }
+
+    if (argc > 1)
+    {
+        regressions = PCF85063AT_Bench_Check(g_Results, count, g_Budget, (uint32_t)budgetCount);
+        if (regressions)
+        {
+            fprintf(stderr, "%u API(s) over budget\n", (unsigned)regressions);
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_bus_check_main.c
+ * @brief The pcf85063at_bus_check_main.c file checks the bus transaction queue of bus_io_i2c.c on the host
+ *  simulation, with the transfers completed from a simulated interrupt.
+
+    Usage: pcf85063at_bus_check
+
+    The transfer events are deferred: they are signalled when the main loop moves the virtual clock by one
+    tick, as the I2C interrupt would preempt it on the target. Checks that queued transactions run in priority
+    order, FIFO within a priority, each one started from the completion of the previous one; that the statistics
+    count them; that a transaction submitted during a blocking call waits for it, and a blocking call for the
+    transaction on the wire; and that a transaction on a stuck bus is failed at its deadline, the bus recovered
+    and the queue run on. Prints "check,<transactions>,transactions" and exits with 0, or prints a FAIL line and
+    exits with 1.
+
+    Build as in pcf85063at_sim.h, with this file as the application.
+*/
+
+/* Standard C Includes */
+#include <stdio.h>
+#include <string.h>
+
+/* ISSDK Includes */
+#include "issdk_hal.h"
+#include "systick_utils.h"
+#include "bus_io_i2c.h"
+#include "pcf85063at_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! The period of the simulated interrupt tick, in nanoseconds. */
+#define BUS_CHECK_TICK_NS (10000U)
+/*! The most ticks the queue may take to drain, 20 ms. */
+#define BUS_CHECK_MAX_TICKS (2000U)
+/*! The transactions of the check. */
+#define BUS_CHECK_TRANSACTIONS (10U)
+
+#define BUS_CHECK(cond)                                                        \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            printf("FAIL,%s:%d,%s\n", __FILE__, __LINE__, #cond);             \
+            return 1;                                                          \
+        }                                                                      \
+    } while (0)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static PCF85063AT_sensorhandle_t g_Rtc;
+static busTransaction_t g_Transaction[BUS_CHECK_TRANSACTIONS];
+static uint8_t g_Buffer[BUS_CHECK_TRANSACTIONS];
+
+/*! Written by the callback, from the simulated interrupt. */
+static volatile uint32_t g_Done;
+static uint32_t g_Order[BUS_CHECK_TRANSACTIONS];
+static int32_t g_Status[BUS_CHECK_TRANSACTIONS];
+static uint32_t g_DoneTick[BUS_CHECK_TRANSACTIONS];
+
+/*! Set by the idle task during a blocking call. */
+static volatile uint32_t g_IdleSubmits;
+static volatile bool g_IdleStarted;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void Bus_Callback(void *pUserData, int32_t status)
+{
+    uint32_t index = (uint32_t)(uintptr_t)pUserData;
+
+    g_Order[g_Done] = index;
+    g_Status[index] = status;
+    g_DoneTick[index] = BOARD_SystickGetTicks();
+    g_Done++;
+}
+
+/* Fill and submit transaction index, a one byte read of the seconds. */
+static int32_t Bus_Submit(uint32_t index, busPriority_t priority)
+{
+    busTransaction_t *pTransaction = &g_Transaction[index];
+
+    memset(pTransaction, 0, sizeof(*pTransaction));
+    pTransaction->pCommDrv = &I2C_S_DRIVER;
+    pTransaction->devInfo = &g_Rtc.deviceInfo;
+    pTransaction->slaveAddress = PCF85063AT_I2C_ADDR;
+    pTransaction->type = BUS_I2C_READ;
+    pTransaction->priority = priority;
+    pTransaction->offset = PCF85063AT_SECOND;
+    pTransaction->length = 1;
+    pTransaction->pBuffer = &g_Buffer[index];
+    pTransaction->callback = Bus_Callback;
+    pTransaction->pUserData = (void *)(uintptr_t)index;
+
+    return Bus_I2C_Submit(pTransaction);
+}
+
+/* Tick the virtual clock until the queue is empty, return the ticks or 0 on a timeout. */
+static uint32_t Bus_Drain(void)
+{
+    uint32_t ticks;
+
+    for (ticks = 1; ticks <= BUS_CHECK_MAX_TICKS; ticks++)
+    {
+        PCF85063AT_Sim_Advance(BUS_CHECK_TICK_NS);
+        if (!Bus_I2C_IsBusy(I2C_S_DEVICE_INDEX))
+        {
+            return ticks;
+        }
+    }
+
+    return 0;
+}
+
+/* Idle task of the blocking calls, submits transaction 5 from within the first one. */
+static void Bus_IdleSubmit(void *pParam)
+{
+    (void)pParam;
+    if (g_IdleSubmits++ == 0)
+    {
+        (void)Bus_Submit(5, BUS_I2C_PRIORITY_HIGH);
+        g_IdleStarted = (g_Transaction[5].xfer.state != REGISTER_ASYNC_IDLE);
+    }
+    __NOP();
+}
+
+int main(void)
+{
+    static const uint32_t order[] = {0, 3, 4, 2, 1};
+    busStats_t stats;
+    uint32_t i, ticks;
+    int32_t status;
+    uint8_t value;
+
+    PCF85063AT_Sim_Init(PCF85063AT_SIM_COMPLETE_DEFERRED);
+    BUS_CHECK(Register_I2C_Initialize(&I2C_S_DRIVER, I2C_S_DEVICE_INDEX, NULL) == ARM_DRIVER_OK);
+    BUS_CHECK(I2C_S_DRIVER.PowerControl(ARM_POWER_FULL) == ARM_DRIVER_OK);
+    BUS_CHECK(PCF85063AT_Initialize(&g_Rtc, &I2C_S_DRIVER, I2C_S_DEVICE_INDEX, PCF85063AT_I2C_ADDR) ==
+              SENSOR_ERROR_NONE);
+
+    /*! Priority order: 0 starts at once, the others queue behind it, HIGH before NORMAL before LOW. */
+    BUS_CHECK(Bus_Submit(0, BUS_I2C_PRIORITY_LOW) == ARM_DRIVER_OK);
+    BUS_CHECK(Bus_Submit(1, BUS_I2C_PRIORITY_LOW) == ARM_DRIVER_OK);
+    BUS_CHECK(Bus_Submit(2, BUS_I2C_PRIORITY_NORMAL) == ARM_DRIVER_OK);
+    BUS_CHECK(Bus_Submit(3, BUS_I2C_PRIORITY_HIGH) == ARM_DRIVER_OK);
+    BUS_CHECK(Bus_Submit(4, BUS_I2C_PRIORITY_HIGH) == ARM_DRIVER_OK);
+    BUS_CHECK(g_Transaction[0].xfer.state != REGISTER_ASYNC_IDLE);
+    BUS_CHECK(Bus_Drain() != 0);
+    BUS_CHECK(g_Done == 5);
+    for (i = 0; i < 5; i++)
+    {
+        BUS_CHECK(g_Order[i] == order[i]);
+        BUS_CHECK(g_Status[order[i]] == ARM_DRIVER_OK);
+    }
+    /*! Back to back: each transaction started on the tick its predecessor completed. */
+    for (i = 1; i < 5; i++)
+    {
+        BUS_CHECK(g_Transaction[order[i]].xfer.startTick == g_DoneTick[order[i - 1]]);
+    }
+    BUS_CHECK(Bus_I2C_GetStats(I2C_S_DEVICE_INDEX, &stats) == ARM_DRIVER_OK);
+    BUS_CHECK(stats.submitted == 5 && stats.completed == 5 && stats.failed == 0 && stats.timeouts == 0);
+    BUS_CHECK(stats.queueDepth == 0 && stats.maxQueueDepth == 4);
+    BUS_CHECK(stats.maxWaitTicks == g_Transaction[1].xfer.startTick - g_Transaction[1].submitTick);
+    BUS_CHECK(stats.maxWaitTicks > 0 && stats.totalWaitTicks > stats.maxWaitTicks);
+
+    /*! A transaction submitted during a blocking call stays queued until the call returns. */
+    PCF85063AT_SetWaitMode(&g_Rtc, REGISTER_WAIT_YIELD);
+    PCF85063AT_SetIdleTask(&g_Rtc, Bus_IdleSubmit, NULL);
+    BUS_CHECK(Register_I2C_Read(&I2C_S_DRIVER, &g_Rtc.deviceInfo, PCF85063AT_I2C_ADDR, PCF85063AT_SECOND, 1,
+                                &value) == ARM_DRIVER_OK);
+    BUS_CHECK(g_IdleSubmits != 0 && !g_IdleStarted);
+    BUS_CHECK(g_Done == 5 && Bus_I2C_IsBusy(I2C_S_DEVICE_INDEX));
+    BUS_CHECK(g_Transaction[5].xfer.state != REGISTER_ASYNC_IDLE);
+    BUS_CHECK(Bus_Drain() != 0);
+    BUS_CHECK(g_Done == 6 && g_Order[5] == 5 && g_Status[5] == ARM_DRIVER_OK);
+
+    /*! A blocking call waits for the transaction on the wire, queued ones run after it. */
+    PCF85063AT_SetIdleTask(&g_Rtc, NULL, NULL);
+    BUS_CHECK(Bus_Submit(6, BUS_I2C_PRIORITY_NORMAL) == ARM_DRIVER_OK);
+    BUS_CHECK(Bus_Submit(7, BUS_I2C_PRIORITY_NORMAL) == ARM_DRIVER_OK);
+    BUS_CHECK(Register_I2C_Read(&I2C_S_DRIVER, &g_Rtc.deviceInfo, PCF85063AT_I2C_ADDR, PCF85063AT_SECOND, 1,
+                                &value) == ARM_DRIVER_OK);
+    BUS_CHECK(g_Done == 7 && g_Order[6] == 6 && g_Status[6] == ARM_DRIVER_OK);
+    BUS_CHECK(Bus_Drain() != 0);
+    BUS_CHECK(g_Done == 8 && g_Order[7] == 7 && g_Status[7] == ARM_DRIVER_OK);
+
+    /*! Deadline: a transaction on a stuck bus fails at the timeout of its device, the next one runs. */
+    PCF85063AT_Sim_SetBusStuck(5);
+    BUS_CHECK(Bus_Submit(8, BUS_I2C_PRIORITY_NORMAL) == ARM_DRIVER_OK);
+    BUS_CHECK(Bus_Submit(9, BUS_I2C_PRIORITY_NORMAL) == ARM_DRIVER_OK);
+    status = ARM_DRIVER_OK;
+    for (ticks = 1; (ticks <= BUS_CHECK_MAX_TICKS) && (ARM_DRIVER_OK == status); ticks++)
+    {
+        PCF85063AT_Sim_Advance(BUS_CHECK_TICK_NS);
+        status = Bus_I2C_Poll(I2C_S_DEVICE_INDEX);
+    }
+    BUS_CHECK(status == ARM_DRIVER_ERROR_TIMEOUT);
+    BUS_CHECK(ticks * BUS_CHECK_TICK_NS >= REGISTER_IO_TIMEOUT_US * 1000U);
+    BUS_CHECK(g_Done == 9 && g_Order[8] == 8 && g_Status[8] == ARM_DRIVER_ERROR_TIMEOUT);
+    BUS_CHECK(Bus_Drain() != 0);
+    BUS_CHECK(g_Done == 10 && g_Order[9] == 9 && g_Status[9] == ARM_DRIVER_OK);
+    BUS_CHECK(Bus_I2C_GetStats(I2C_S_DEVICE_INDEX, &stats) == ARM_DRIVER_OK);
+    BUS_CHECK(stats.submitted == 10 && stats.completed == 9 && stats.failed == 1 && stats.timeouts == 1);
+
+    printf("check,%u,transactions\n", (unsigned)g_Done);
+
+    return 0;
+}
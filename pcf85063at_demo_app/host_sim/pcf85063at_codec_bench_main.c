@@ -0,0 +1,390 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_codec_bench_main.c
+ * @brief The pcf85063at_codec_bench_main.c file checks PCF85063AT_TimeToBcd() and PCF85063AT_BcdToTime()
+ *  against the per field DecimaltoBcd() and BcdToDecimal() conversion and compares their speed on the host.
+
+    Usage: pcf85063at_codec_bench [iterations]
+
+    Every time of 2000 to 2099 is encoded and decoded in both hour modes, and every value of every register
+    is decoded alone, and the results are compared with the per field conversion. Then each conversion is
+    timed over the iterations, 1000000 by default, and printed as comma separated nanoseconds per frame.
+    Exits with 1 on the first mismatch.
+
+    Build as in pcf85063at_sim.h, with this file as the application. Use -O2 for the timings.
+*/
+
+/* Standard C Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ISSDK Includes */
+#include "issdk_hal.h"
+#include "pcf85063at_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define CODEC_BENCH_FRAMES     (1024)
+#define CODEC_BENCH_ITERATIONS (1000000UL)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const uint8_t s_daysInMonth[13] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+static PCF85063AT_timedata_t g_Times[CODEC_BENCH_FRAMES];
+static PCF85063AT_timeframe_t g_Frames[CODEC_BENCH_FRAMES];
+static volatile uint32_t g_Sink;
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/*! The conversion the driver made before the packed codec, one field at a time. */
+static void Reference_Encode(const PCF85063AT_timedata_t *time, PCF85063AT_timeframe_t *raw)
+{
+    raw->seconds = DecimaltoBcd(time->second & PCF85063AT_SECONDS_MASK);
+    raw->minutes = DecimaltoBcd(time->minutes & PCF85063AT_MINUTES_MASK);
+    if (time->ampm == h24)
+    {
+        raw->hours = DecimaltoBcd(time->hours & PCF85063AT_HOURS_MASk_24H);
+    }
+    else
+    {
+        raw->hours = DecimaltoBcd(time->hours & PCF85063AT_HOURS_MASK_12H);
+        if (time->ampm == PM)
+        {
+            raw->hours |= (PM << PCF85063AT_AM_PM_SHIFT);
+        }
+    }
+    raw->days = DecimaltoBcd(time->days & PCF85063AT_DAYS_MASK);
+    raw->weekdays = DecimaltoBcd(time->weekdays & PCF85063AT_WEEKDAYS_MASK);
+    raw->months = DecimaltoBcd(time->months & PCF85063AT_MONTHS_MASK);
+    raw->years = DecimaltoBcd(time->years & PCF85063AT_YEARS_MASK);
+}
+
+static void Reference_Decode(const PCF85063AT_timeframe_t *raw, Mode12h_24h mode12_24, PCF85063AT_timedata_t *time)
+{
+    time->second = BcdToDecimal(raw->seconds & PCF85063AT_SECONDS_MASK);
+    time->minutes = BcdToDecimal(raw->minutes & PCF85063AT_MINUTES_MASK);
+    if (mode12_24 == mode24H)
+    {
+        time->hours = BcdToDecimal(raw->hours & PCF85063AT_HOURS_MASk_24H);
+        time->ampm = h24;
+    }
+    else
+    {
+        time->hours = BcdToDecimal(raw->hours & PCF85063AT_HOURS_MASK_12H);
+        time->ampm = ((raw->hours >> PCF85063AT_AM_PM_SHIFT) & 0x01) ? PM : AM;
+    }
+    time->days = BcdToDecimal(raw->days & PCF85063AT_DAYS_MASK);
+    time->weekdays = BcdToDecimal(raw->weekdays & PCF85063AT_WEEKDAYS_MASK);
+    time->months = BcdToDecimal(raw->months & PCF85063AT_MONTHS_MASK);
+    time->years = BcdToDecimal(raw->years);
+}
+
+/*! Register i of the frame, Seconds being 0. */
+static uint8_t *Codec_Byte(PCF85063AT_timeframe_t *raw, int i)
+{
+    uint8_t *bytes[PCF85063AT_TIME_SIZE_BYTE] = {&raw->seconds, &raw->minutes, &raw->hours, &raw->days,
+                                                 &raw->weekdays, &raw->months, &raw->years};
+
+    return bytes[i];
+}
+
+/*! The register bytes the per field conversion accepts as a valid time. */
+static bool Reference_Valid(PCF85063AT_timeframe_t *raw, Mode12h_24h mode12_24)
+{
+    static const uint8_t masks24[7] = {0x7F, 0x7F, 0x3F, 0x3F, 0x07, 0x1F, 0xFF};
+    static const uint8_t masks12[7] = {0x7F, 0x7F, 0x1F, 0x3F, 0x07, 0x1F, 0xFF};
+    PCF85063AT_timedata_t time;
+    const uint8_t *masks = (mode12_24 == mode24H) ? masks24 : masks12;
+    uint8_t dim;
+
+    for (int i = 0; i < PCF85063AT_TIME_SIZE_BYTE; i++)
+    {
+        uint8_t value = *Codec_Byte(raw, i) & masks[i];
+
+        if ((value & 0x0F) > 9 || (value >> 4) > 9)
+        {
+            return false;
+        }
+    }
+    Reference_Decode(raw, mode12_24, &time);
+    if (time.second > 59 || time.minutes > 59 || time.weekdays > 6 || time.months < 1 || time.months > 12 ||
+        time.years > 99)
+    {
+        return false;
+    }
+    if ((mode12_24 == mode24H) ? (time.hours > 23) : (time.hours < 1 || time.hours > 12))
+    {
+        return false;
+    }
+    dim = s_daysInMonth[time.months] + ((time.months == 2 && (time.years & 0x03) == 0) ? 1 : 0);
+
+    return time.days >= 1 && time.days <= dim;
+}
+
+static bool Codec_Same(const PCF85063AT_timedata_t *a, const PCF85063AT_timedata_t *b)
+{
+    return a->second == b->second && a->minutes == b->minutes && a->hours == b->hours && a->days == b->days &&
+           a->weekdays == b->weekdays && a->months == b->months && a->years == b->years && a->ampm == b->ampm;
+}
+
+/*! Encodes with both, decodes the frame with both and compares everything. */
+static bool Codec_CheckTime(const PCF85063AT_timedata_t *time)
+{
+    PCF85063AT_timeframe_t reference, packed;
+    PCF85063AT_timedata_t decoded, expected;
+    Mode12h_24h mode12_24 = (time->ampm == h24) ? mode24H : mode12H;
+
+    Reference_Encode(time, &reference);
+    if (SENSOR_ERROR_NONE != PCF85063AT_TimeToBcd(time, &packed) ||
+        0 != memcmp(&reference, &packed, sizeof(packed)))
+    {
+        return false;
+    }
+    Reference_Decode(&reference, mode12_24, &expected);
+
+    return SENSOR_ERROR_NONE == PCF85063AT_BcdToTime(&packed, mode12_24, &decoded) && Codec_Same(&decoded, &expected) &&
+           Codec_Same(&decoded, time);
+}
+
+static int Codec_CheckAll(void)
+{
+    static const uint8_t hours12[] = {12, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    PCF85063AT_timedata_t time;
+    PCF85063AT_timeframe_t raw;
+    uint32_t count = 0;
+
+    /*! Every date and hour of the century in each mode, minutes and seconds moving with them. */
+    for (uint32_t years = 0; years <= 99; years++)
+    {
+        for (uint32_t months = 1; months <= 12; months++)
+        {
+            uint32_t dim = s_daysInMonth[months] + ((months == 2 && (years & 0x03) == 0) ? 1 : 0);
+
+            for (uint32_t days = 1; days <= dim; days++)
+            {
+                for (uint32_t hour = 0; hour < 24; hour++)
+                {
+                    time.second = (uint8_t)((days * 7 + hour) % 60);
+                    time.minutes = (uint8_t)((years + months * 5 + hour * 11) % 60);
+                    time.days = (uint8_t)days;
+                    time.weekdays = (uint8_t)((years + days) % 7);
+                    time.months = (uint8_t)months;
+                    time.years = (uint8_t)years;
+
+                    time.hours = (uint8_t)hour;
+                    time.ampm = h24;
+                    if (!Codec_CheckTime(&time))
+                    {
+                        printf("FAIL,24h,%02u-%02u-%02u %02u\n", years, months, days, hour);
+                        return 1;
+                    }
+                    time.hours = hours12[hour % 12];
+                    time.ampm = (hour < 12) ? AM : PM;
+                    if (!Codec_CheckTime(&time))
+                    {
+                        printf("FAIL,12h,%02u-%02u-%02u %02u\n", years, months, days, hour);
+                        return 1;
+                    }
+                    count += 2;
+                }
+            }
+        }
+    }
+
+    /*! Every minute and second of one day. */
+    time.days = 29;
+    time.weekdays = 6;
+    time.months = 2;
+    time.years = 24;
+    time.hours = 23;
+    time.ampm = h24;
+    for (uint32_t minutes = 0; minutes < 60; minutes++)
+    {
+        for (uint32_t second = 0; second < 60; second++)
+        {
+            time.minutes = (uint8_t)minutes;
+            time.second = (uint8_t)second;
+            if (!Codec_CheckTime(&time))
+            {
+                printf("FAIL,24h,%02u:%02u\n", minutes, second);
+                return 1;
+            }
+            count++;
+        }
+    }
+
+    /*! Every value of every register on a valid frame, decoded and judged by both. */
+    for (int mode = mode24H; mode <= mode12H; mode++)
+    {
+        for (int i = 0; i < PCF85063AT_TIME_SIZE_BYTE; i++)
+        {
+            for (uint32_t value = 0; value < 256; value++)
+            {
+                PCF85063AT_timedata_t decoded, expected;
+                bool valid;
+
+                /*! 2024-01-31 11:59:58, Tuesday. */
+                raw.seconds = 0x58;
+                raw.minutes = 0x59;
+                raw.hours = 0x11;
+                raw.days = 0x31;
+                raw.weekdays = 0x02;
+                raw.months = 0x01;
+                raw.years = 0x24;
+                *Codec_Byte(&raw, i) = (uint8_t)value;
+                valid = Reference_Valid(&raw, (Mode12h_24h)mode);
+                if ((SENSOR_ERROR_NONE == PCF85063AT_BcdToTime(&raw, (Mode12h_24h)mode, &decoded)) != valid)
+                {
+                    printf("FAIL,decode,%s,register %d,0x%02X\n", (mode == mode24H) ? "24h" : "12h", i, value);
+                    return 1;
+                }
+                Reference_Decode(&raw, (Mode12h_24h)mode, &expected);
+                if (valid && !Codec_Same(&decoded, &expected))
+                {
+                    printf("FAIL,decode,%s,register %d,0x%02X\n", (mode == mode24H) ? "24h" : "12h", i, value);
+                    return 1;
+                }
+                count++;
+            }
+        }
+    }
+
+    /*! Fields out of range are refused before anything is written. */
+    time.second = 0;
+    time.minutes = 0;
+    time.hours = 0;
+    time.days = 29;
+    time.weekdays = 0;
+    time.months = 2;
+    time.years = 23;
+    time.ampm = h24;
+    if (SENSOR_ERROR_NONE == PCF85063AT_TimeToBcd(&time, &raw))
+    {
+        printf("FAIL,encode,29 February 2023\n");
+        return 1;
+    }
+    time.years = 24;
+    time.hours = 24;
+    if (SENSOR_ERROR_NONE == PCF85063AT_TimeToBcd(&time, &raw))
+    {
+        printf("FAIL,encode,hour 24\n");
+        return 1;
+    }
+    time.hours = 0;
+    time.ampm = AM;
+    if (SENSOR_ERROR_NONE == PCF85063AT_TimeToBcd(&time, &raw))
+    {
+        printf("FAIL,encode,hour 0 AM\n");
+        return 1;
+    }
+    time.ampm = h24;
+    time.months = 13;
+    if (SENSOR_ERROR_NONE == PCF85063AT_TimeToBcd(&time, &raw))
+    {
+        printf("FAIL,encode,month 13\n");
+        return 1;
+    }
+
+    printf("check,%u,frames\n", count);
+
+    return 0;
+}
+
+static uint64_t Codec_NowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static void Codec_Report(const char *name, uint64_t startNs, unsigned long iterations)
+{
+    printf("%s,%.2f\n", name, (double)(Codec_NowNs() - startNs) / (double)iterations);
+}
+
+static void Codec_Time(unsigned long iterations)
+{
+    PCF85063AT_timedata_t time;
+    PCF85063AT_timeframe_t raw;
+    uint32_t sum = 0;
+    uint64_t start;
+
+    for (uint32_t i = 0; i < CODEC_BENCH_FRAMES; i++)
+    {
+        g_Times[i].second = (uint8_t)(i % 60);
+        g_Times[i].minutes = (uint8_t)((i * 7) % 60);
+        g_Times[i].hours = (uint8_t)((i * 5) % 24);
+        g_Times[i].days = (uint8_t)(1 + (i * 3) % 28);
+        g_Times[i].weekdays = (uint8_t)(i % 7);
+        g_Times[i].months = (uint8_t)(1 + i % 12);
+        g_Times[i].years = (uint8_t)(i % 100);
+        g_Times[i].ampm = h24;
+        Reference_Encode(&g_Times[i], &g_Frames[i]);
+    }
+
+    printf("codec,ns_per_frame\n");
+
+    start = Codec_NowNs();
+    for (unsigned long n = 0; n < iterations; n++)
+    {
+        Reference_Encode(&g_Times[n % CODEC_BENCH_FRAMES], &raw);
+        sum += raw.hours;
+    }
+    Codec_Report("DecimaltoBcd", start, iterations);
+
+    start = Codec_NowNs();
+    for (unsigned long n = 0; n < iterations; n++)
+    {
+        sum += (uint32_t)PCF85063AT_TimeToBcd(&g_Times[n % CODEC_BENCH_FRAMES], &raw);
+        sum += raw.hours;
+    }
+    Codec_Report("PCF85063AT_TimeToBcd", start, iterations);
+
+    start = Codec_NowNs();
+    for (unsigned long n = 0; n < iterations; n++)
+    {
+        Reference_Decode(&g_Frames[n % CODEC_BENCH_FRAMES], mode24H, &time);
+        sum += time.days;
+    }
+    Codec_Report("BcdToDecimal", start, iterations);
+
+    start = Codec_NowNs();
+    for (unsigned long n = 0; n < iterations; n++)
+    {
+        sum += (uint32_t)PCF85063AT_BcdToTime(&g_Frames[n % CODEC_BENCH_FRAMES], mode24H, &time);
+        sum += time.days;
+    }
+    Codec_Report("PCF85063AT_BcdToTime", start, iterations);
+
+    g_Sink = sum;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long iterations = (argc > 1) ? strtoul(argv[1], NULL, 0) : CODEC_BENCH_ITERATIONS;
+
+    if (0 != Codec_CheckAll())
+    {
+        return 1;
+    }
+    if (iterations > 0)
+    {
+        Codec_Time(iterations);
+    }
+
+    return 0;
+}
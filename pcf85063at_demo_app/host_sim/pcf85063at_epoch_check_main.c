@@ -0,0 +1,167 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_epoch_check_main.c
+ * @brief The pcf85063at_epoch_check_main.c file checks PCF85063AT_EpochToTime() and PCF85063AT_TimeToEpoch()
+ *  against gmtime() of the host C library.
+
+    Usage: pcf85063at_epoch_check [stride]
+
+    Unix times of 2000 to 2099 are taken every stride seconds, 997 by default so that every second and minute
+    value comes up, together with the first and the last second of every day. Each one is converted to a time
+    in both hour modes and compared field by field with gmtime(), weekday included, then converted back and
+    compared with the Unix time. The first second out of range on either side must be refused, and so must the
+    days 29 to 31 past the end of their month, 31 April or 29 February of a common year. Prints
+    "check,<conversions>,conversions" and exits with 0, or prints a FAIL line and exits with 1.
+
+    Build as in pcf85063at_sim.h, with this file as the application.
+*/
+
+/* Standard C Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ISSDK Includes */
+#include "issdk_hal.h"
+#include "pcf85063at_drv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define EPOCH_CHECK_STRIDE (997UL)
+
+#define EPOCH_CHECK(cond, epoch)                                                                  \
+    do                                                                                            \
+    {                                                                                             \
+        if (!(cond))                                                                              \
+        {                                                                                         \
+            printf("FAIL,%s:%d,%s,%lu\n", __FILE__, __LINE__, #cond, (unsigned long)(epoch));    \
+            return 1;                                                                             \
+        }                                                                                         \
+    } while (0)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static unsigned long g_Conversions;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Check one Unix time in both hour modes, both ways. */
+static int Epoch_Check(uint32_t epoch)
+{
+    PCF85063AT_timedata_t time;
+    struct tm expected;
+    time_t seconds = (time_t)epoch;
+    uint32_t back;
+    int mode;
+
+    EPOCH_CHECK(gmtime_r(&seconds, &expected) != NULL, epoch);
+    for (mode = mode24H; mode <= mode12H; mode++)
+    {
+        EPOCH_CHECK(PCF85063AT_EpochToTime(epoch, (Mode12h_24h)mode, &time) == SENSOR_ERROR_NONE, epoch);
+        EPOCH_CHECK(time.years == expected.tm_year - 100 && time.months == expected.tm_mon + 1, epoch);
+        EPOCH_CHECK(time.days == expected.tm_mday && time.weekdays == expected.tm_wday, epoch);
+        EPOCH_CHECK(time.minutes == expected.tm_min && time.second == expected.tm_sec, epoch);
+        if (mode == mode24H)
+        {
+            EPOCH_CHECK(time.ampm == h24 && time.hours == expected.tm_hour, epoch);
+        }
+        else
+        {
+            /*! 12 AM is midnight and 12 PM is noon. */
+            EPOCH_CHECK(time.ampm == ((expected.tm_hour < 12) ? AM : PM), epoch);
+            EPOCH_CHECK(time.hours == ((expected.tm_hour % 12 == 0) ? 12 : expected.tm_hour % 12), epoch);
+        }
+
+        EPOCH_CHECK(PCF85063AT_TimeToEpoch(&time, &back) == SENSOR_ERROR_NONE, epoch);
+        EPOCH_CHECK(back == epoch, epoch);
+        g_Conversions += 2;
+    }
+
+    return 0;
+}
+
+/* Check that the days 29 to 31 of a month are converted when gmtime() keeps them in the month, refused if not. */
+static int Epoch_CheckMonthEnd(uint8_t years, uint8_t months)
+{
+    PCF85063AT_timedata_t time = {.hours = 12, .years = years, .months = months, .ampm = h24};
+    struct tm date = {.tm_hour = 12, .tm_year = years + 100, .tm_mon = months - 1};
+    uint32_t epoch, expected;
+    int32_t status;
+
+    for (time.days = 29; time.days <= 31; time.days++)
+    {
+        date.tm_mday = time.days;
+        date.tm_mon = months - 1;
+        expected = (uint32_t)timegm(&date);
+        status = PCF85063AT_TimeToEpoch(&time, &epoch);
+        if (date.tm_mon == months - 1)
+        {
+            EPOCH_CHECK(status == SENSOR_ERROR_NONE && epoch == expected, expected);
+        }
+        else
+        {
+            EPOCH_CHECK(status == SENSOR_ERROR_INVALID_PARAM, expected);
+        }
+        g_Conversions++;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    PCF85063AT_timedata_t time;
+    unsigned long stride = (argc > 1) ? strtoul(argv[1], NULL, 0) : EPOCH_CHECK_STRIDE;
+    uint32_t epoch;
+    uint8_t years, months;
+
+    if (stride == 0)
+    {
+        printf("Usage: %s [stride]\n", argv[0]);
+        return 2;
+    }
+
+    for (epoch = PCF85063AT_EPOCH_2000; epoch < PCF85063AT_EPOCH_2100; epoch += 86400U)
+    {
+        if (Epoch_Check(epoch) || Epoch_Check(epoch + 86399U))
+        {
+            return 1;
+        }
+    }
+    for (epoch = PCF85063AT_EPOCH_2000; epoch < PCF85063AT_EPOCH_2100; epoch += stride)
+    {
+        if (Epoch_Check(epoch))
+        {
+            return 1;
+        }
+    }
+
+    for (years = 0; years <= 99; years++)
+    {
+        for (months = 1; months <= 12; months++)
+        {
+            if (Epoch_CheckMonthEnd(years, months))
+            {
+                return 1;
+            }
+        }
+    }
+
+    EPOCH_CHECK(PCF85063AT_EpochToTime(PCF85063AT_EPOCH_2000 - 1U, mode24H, &time) == SENSOR_ERROR_INVALID_PARAM,
+                PCF85063AT_EPOCH_2000 - 1U);
+    EPOCH_CHECK(PCF85063AT_EpochToTime(PCF85063AT_EPOCH_2100, mode12H, &time) == SENSOR_ERROR_INVALID_PARAM,
+                PCF85063AT_EPOCH_2100);
+
+    printf("check,%lu,conversions\n", g_Conversions);
+
+    return 0;
+}
@@ -0,0 +1,1009 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_sim.c
+ * @brief The pcf85063at_sim.c file implements the register level simulation of the PCF85063AT.
+
+    The oscillator is modelled as a 32.768 kHz prescaler whose rate follows the crystal error and the
+    offset register averaged over the correction period; single correction pulses and the correction
+    interrupt are not modelled, nor is CLKOUT. The countdown timer counts from its own phase, so the first
+    period after a load is a full period; while it runs, Timer_value reads back the current countdown value.
+*/
+
+/* Standard C Includes */
+#include <string.h>
+
+/* ISSDK Includes */
+#include "pcf85063at.h"
+#include "pcf85063at_sim.h"
+#include "systick_utils.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SIM_PRESCALER_HZ    (32768U)
+#define SIM_SOFTWARE_RESET  (0x58)
+#define SIM_START_STOP_BITS (2U) /* START and STOP conditions, in bit times. */
+#define SIM_DMA_BUFFER_SIZE (256U) /* Longest read of Driver_I2C_SimDma. */
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+typedef struct
+{
+    uint8_t reg[PCF85063AT_SIM_REG_COUNT];
+    uint8_t pointer;          /* Register address auto-incremented by the transfers. */
+    uint8_t countdown;        /* Countdown timer, reloaded from Timer_value. */
+    uint32_t prescaler;       /* 32.768 kHz ticks within the second. */
+    uint32_t timerPhase;      /* 32.768 kHz ticks within the timer period. */
+    double tickFraction;      /* 32.768 kHz tick not complete yet. */
+    bool alarmMatch;          /* Alarm matched at the previous second. */
+    bool intb;                /* INTB asserted. */
+    bool oscillatorStopped;
+    int32_t crystalPpb;
+    uint64_t nowNs;
+
+    PCF85063AT_SIM_COMPLETION completion;
+    ARM_I2C_SignalEvent_t cbEvent;
+    ARM_I2C_SignalEvent_t cbEventDma;
+    bool dmaActive;           /* The transfer in flight was started by Driver_I2C_SimDma. */
+    const uint8_t *pDmaTx;    /* Bytes the DMA takes from the caller when the transfer ends. */
+    uint8_t *pDmaRx;          /* Buffer the DMA fills when the transfer ends. */
+    uint8_t dmaRx[SIM_DMA_BUFFER_SIZE]; /* Registers latched at the start of a DMA read. */
+    uint32_t busSpeedHz;
+    uint32_t wakeLatencyNs;   /* Time the waiting thread takes to run again after the last transfer event. */
+    bool busy;
+    uint64_t busyUntilNs;
+    uint32_t pendingEvent;
+    uint32_t dataCount;
+    uint32_t faultCount;
+    uint32_t faultEvent;
+    uint32_t stuckClocks;     /* SCL pulses until the device releases SDA, 0 when released. */
+    bool hung;                /* A transfer was started while SDA was held low, it ends only when aborted. */
+    bool sclLow;              /* SCL driven low on the GPIO. */
+    bool sdaLow;              /* SDA driven low on the GPIO. */
+
+    PCF85063AT_sim_intbcallback_t intbCallback;
+    void *pIntbUserData;
+    PCF85063AT_simstats_t stats;
+} simDevice_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static simDevice_t g_Sim;
+
+/*! Register values after power on and software reset. */
+static const uint8_t s_resetValue[PCF85063AT_SIM_REG_COUNT] = {
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x06,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x18,
+};
+
+/*! Implemented bits, the others read 0. */
+static const uint8_t s_readMask[PCF85063AT_SIM_REG_COUNT] = {
+    0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0x07,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xBF, 0xBF, 0x87, 0xFF, 0x1F,
+};
+
+/*! Countdown timer source clock per TCF, in 32.768 kHz ticks. */
+static const uint32_t s_timerDivider[4] = {SIM_PRESCALER_HZ / 4096U, SIM_PRESCALER_HZ / 64U, SIM_PRESCALER_HZ,
+                                           SIM_PRESCALER_HZ * 60U};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint8_t Sim_BcdToBin(uint8_t bcd)
+{
+    return (uint8_t)((bcd >> 4) * 10 + (bcd & 0x0F));
+}
+
+static uint8_t Sim_BinToBcd(uint8_t bin)
+{
+    return (uint8_t)(((bin / 10) << 4) | (bin % 10));
+}
+
+static uint8_t Sim_DaysInMonth(uint8_t month, uint8_t year)
+{
+    static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+    /*! Leap years are the multiples of 4, 2000 included. */
+    if ((month == 2) && ((year % 4) == 0))
+    {
+        return 29;
+    }
+    return days[(month - 1) % 12];
+}
+
+static bool Sim_AlarmMatches(void)
+{
+    static const struct
+    {
+        uint8_t alarm, time, mask;
+    } fields[] = {
+        {PCF85063AT_SECOND_ALARM, PCF85063AT_SECOND, 0x7F}, {PCF85063AT_MINUTE_ALARM, PCF85063AT_MINUTE, 0x7F},
+        {PCF85063AT_HOUR_ALARM, PCF85063AT_HOUR, 0x3F},     {PCF85063AT_DAY_ALARM, PCF85063AT_DAY, 0x3F},
+        {PCF85063AT_WEEKDAY_ALARM, PCF85063AT_WEEKDAY, 0x07},
+    };
+    bool enabled = false;
+    uint8_t i;
+
+    /*! AEN clear enables a field, the alarm needs at least one field and every enabled one to match. */
+    for (i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+    {
+        if (g_Sim.reg[fields[i].alarm] & 0x80)
+        {
+            continue;
+        }
+        enabled = true;
+        if ((g_Sim.reg[fields[i].alarm] & fields[i].mask) != (g_Sim.reg[fields[i].time] & fields[i].mask))
+        {
+            return false;
+        }
+    }
+
+    return enabled;
+}
+
+/* Follow INTB after a flag or an enable changed, pulse for a TF event in pulse mode. */
+static void Sim_UpdateIntb(bool tfEvent)
+{
+    uint8_t ctrl2 = g_Sim.reg[PCF85063AT_CTRL2];
+    uint8_t mode = g_Sim.reg[PCF85063AT_TIMER_MODE];
+    bool tfEnabled = (ctrl2 & (PCF85063AT_CTRL2_MI_MASK | PCF85063AT_CTRL2_HMI_MASK)) ||
+                     (mode & PCF85063AT_SECONDS_TIE_MASK);
+    bool pulseMode = (mode & PCF85063AT_SECONDS_TI_TP_MASK) != 0;
+    bool level, pulse;
+
+    level = ((ctrl2 & PCF85063AT_CTRL2_AIE_MASK) && (ctrl2 & PCF85063AT_CTRL2_AF_MASK)) ||
+            (tfEnabled && !pulseMode && (ctrl2 & PCF85063AT_CTRL2_TF_MASK));
+    pulse = tfEvent && tfEnabled && pulseMode;
+
+    /*! INTB is open drain, a pulse is not seen while the line is held low. */
+    if (!g_Sim.intb && (level || pulse))
+    {
+        g_Sim.stats.intbEdges++;
+        g_Sim.intb = level;
+        if (g_Sim.intbCallback)
+        {
+            g_Sim.intbCallback(g_Sim.pIntbUserData);
+        }
+        return;
+    }
+    g_Sim.intb = level;
+}
+
+static void Sim_Reset(void)
+{
+    memcpy(g_Sim.reg, s_resetValue, sizeof(g_Sim.reg));
+    g_Sim.pointer = 0;
+    g_Sim.countdown = 0;
+    g_Sim.prescaler = 0;
+    g_Sim.timerPhase = 0;
+    g_Sim.tickFraction = 0;
+    g_Sim.alarmMatch = false;
+    Sim_UpdateIntb(false);
+}
+
+static void Sim_SecondTick(void)
+{
+    uint8_t *reg = g_Sim.reg;
+    uint8_t second, minute, hour, day, weekday, month, year;
+    bool tfEvent = false, match;
+
+    second = Sim_BcdToBin(reg[PCF85063AT_SECOND] & 0x7F) + 1;
+    minute = Sim_BcdToBin(reg[PCF85063AT_MINUTE]);
+    hour = reg[PCF85063AT_HOUR];
+    day = Sim_BcdToBin(reg[PCF85063AT_DAY]);
+    weekday = reg[PCF85063AT_WEEKDAY];
+    month = Sim_BcdToBin(reg[PCF85063AT_MONTH]);
+    year = Sim_BcdToBin(reg[PCF85063AT_YEAR]);
+
+    if (second >= 60)
+    {
+        second = 0;
+        if (++minute >= 60)
+        {
+            bool newDay = false;
+
+            minute = 0;
+            if (reg[PCF85063AT_CTRL1] & PCF85063AT_CTRL1_12_HOUR_24_HOUR_MODE_MASK)
+            {
+                /*! 12 h mode, 11 PM to 12 AM starts a new day. */
+                uint8_t h12 = Sim_BcdToBin(hour & 0x1F);
+                uint8_t pm = hour & 0x20;
+
+                if (h12 == 11)
+                {
+                    pm ^= 0x20;
+                    newDay = (pm == 0);
+                    h12 = 12;
+                }
+                else
+                {
+                    h12 = (h12 == 12) ? 1 : h12 + 1;
+                }
+                hour = pm | Sim_BinToBcd(h12);
+            }
+            else
+            {
+                uint8_t h24 = Sim_BcdToBin(hour & 0x3F) + 1;
+
+                newDay = (h24 >= 24);
+                hour = Sim_BinToBcd(newDay ? 0 : h24);
+            }
+
+            if (newDay)
+            {
+                weekday = (weekday + 1) % 7;
+                if (++day > Sim_DaysInMonth(month, year))
+                {
+                    day = 1;
+                    if (++month > 12)
+                    {
+                        month = 1;
+                        year = (year + 1) % 100;
+                    }
+                }
+            }
+        }
+    }
+
+    reg[PCF85063AT_SECOND] = (reg[PCF85063AT_SECOND] & PCF85063AT_OS_MASK) | Sim_BinToBcd(second);
+    reg[PCF85063AT_MINUTE] = Sim_BinToBcd(minute);
+    reg[PCF85063AT_HOUR] = hour;
+    reg[PCF85063AT_DAY] = Sim_BinToBcd(day);
+    reg[PCF85063AT_WEEKDAY] = weekday;
+    reg[PCF85063AT_MONTH] = Sim_BinToBcd(month);
+    reg[PCF85063AT_YEAR] = Sim_BinToBcd(year);
+
+    /*! Minute and half minute interrupts share TF with the countdown timer. */
+    if (((reg[PCF85063AT_CTRL2] & PCF85063AT_CTRL2_MI_MASK) && (second == 0)) ||
+        ((reg[PCF85063AT_CTRL2] & PCF85063AT_CTRL2_HMI_MASK) && ((second % 30) == 0)))
+    {
+        reg[PCF85063AT_CTRL2] |= PCF85063AT_CTRL2_TF_MASK;
+        tfEvent = true;
+    }
+
+    /*! AF is set when the time starts matching the alarm. */
+    match = Sim_AlarmMatches();
+    if (match && !g_Sim.alarmMatch)
+    {
+        reg[PCF85063AT_CTRL2] |= PCF85063AT_CTRL2_AF_MASK;
+    }
+    g_Sim.alarmMatch = match;
+
+    Sim_UpdateIntb(tfEvent);
+}
+
+static void Sim_TimerExpired(void)
+{
+    g_Sim.countdown = g_Sim.reg[PCF85063AT_TIMER_VALUE];
+    g_Sim.reg[PCF85063AT_CTRL2] |= PCF85063AT_CTRL2_TF_MASK;
+    Sim_UpdateIntb(true);
+}
+
+/* Count prescaler ticks, jumping from one second or timer event to the next. */
+static void Sim_CountTicks(uint64_t ticks)
+{
+    uint64_t step, toTimer;
+    uint32_t divider;
+    bool timerRunning;
+
+    while (ticks)
+    {
+        divider = s_timerDivider[(g_Sim.reg[PCF85063AT_TIMER_MODE] >> 3) & 0x03];
+        timerRunning = (g_Sim.reg[PCF85063AT_TIMER_MODE] & PCF85063AT_SECONDS_TE_MASK) && (g_Sim.countdown != 0);
+
+        step = SIM_PRESCALER_HZ - g_Sim.prescaler;
+        if (timerRunning)
+        {
+            toTimer = (uint64_t)(g_Sim.countdown - 1) * divider + (divider - g_Sim.timerPhase);
+            if (toTimer < step)
+            {
+                step = toTimer;
+            }
+        }
+        if (ticks < step)
+        {
+            step = ticks;
+        }
+        ticks -= step;
+
+        g_Sim.prescaler += (uint32_t)step;
+        if (timerRunning)
+        {
+            step += g_Sim.timerPhase;
+            g_Sim.countdown -= (uint8_t)(step / divider);
+            g_Sim.timerPhase = (uint32_t)(step % divider);
+            if (g_Sim.countdown == 0)
+            {
+                Sim_TimerExpired();
+            }
+        }
+        if (g_Sim.prescaler >= SIM_PRESCALER_HZ)
+        {
+            g_Sim.prescaler = 0;
+            Sim_SecondTick();
+        }
+    }
+}
+
+/* Move the virtual clock without signalling transfer events. */
+static void Sim_AdvanceClock(uint64_t ns)
+{
+    int8_t offset;
+    int64_t ppb;
+    double ticks;
+    uint64_t whole;
+
+    g_Sim.nowNs += ns;
+
+    /*! STOP freezes the prescaler and the timer, so does a stopped oscillator. */
+    if (g_Sim.oscillatorStopped || (g_Sim.reg[PCF85063AT_CTRL1] & PCF85063AT_CTRL1_START_STOP_MASK))
+    {
+        return;
+    }
+
+    /*! Offset is 7 bit two's complement, 4.34 ppm per step every 2 hours or 4.069 ppm every 4 minutes. */
+    offset = (int8_t)(g_Sim.reg[PCF85063AT_OFFSET] << 1) >> 1;
+    ppb = g_Sim.crystalPpb +
+          (int64_t)offset * ((g_Sim.reg[PCF85063AT_OFFSET] & PCF85063AT_OFFSET_MODE_MASK) ? 4069 : 4340);
+
+    ticks = g_Sim.tickFraction + (double)ns * (SIM_PRESCALER_HZ / 1e9) * (1.0 + (double)ppb / 1e9);
+    whole = (uint64_t)ticks;
+    g_Sim.tickFraction = ticks - (double)whole;
+
+    Sim_CountTicks(whole);
+}
+
+static void Sim_WriteRegister(uint8_t offset, uint8_t value)
+{
+    uint8_t old;
+
+    /*! Past the map, the callers wrap the address pointer before the next byte. */
+    if (offset >= PCF85063AT_SIM_REG_COUNT)
+    {
+        return;
+    }
+    old = g_Sim.reg[offset];
+
+    switch (offset)
+    {
+        case PCF85063AT_CTRL1:
+            if (value == SIM_SOFTWARE_RESET)
+            {
+                Sim_Reset();
+                return;
+            }
+            g_Sim.reg[offset] = value & s_readMask[offset];
+            /*! Setting STOP resets the prescaler, the first second after STOP is cleared is a full one. */
+            if ((value & PCF85063AT_CTRL1_START_STOP_MASK) && !(old & PCF85063AT_CTRL1_START_STOP_MASK))
+            {
+                g_Sim.prescaler = 0;
+                g_Sim.tickFraction = 0;
+            }
+            break;
+        case PCF85063AT_CTRL2:
+            /*! AF and TF are cleared by writing 0, writing 1 leaves them unchanged. */
+            g_Sim.reg[offset] = (value & ~PCF85063AT_CTRL2_FLAGS_MASK) | (value & old & PCF85063AT_CTRL2_FLAGS_MASK);
+            break;
+        case PCF85063AT_TIMER_VALUE:
+            g_Sim.reg[offset] = value;
+            g_Sim.countdown = value;
+            g_Sim.timerPhase = 0;
+            break;
+        case PCF85063AT_TIMER_MODE:
+            g_Sim.reg[offset] = value & s_readMask[offset];
+            if ((value & PCF85063AT_SECONDS_TE_MASK) && !(old & PCF85063AT_SECONDS_TE_MASK))
+            {
+                g_Sim.countdown = g_Sim.reg[PCF85063AT_TIMER_VALUE];
+                g_Sim.timerPhase = 0;
+            }
+            break;
+        default:
+            g_Sim.reg[offset] = value & s_readMask[offset];
+            /*! A new time or alarm only matches from the next second on. */
+            if ((offset >= PCF85063AT_SECOND) && (offset <= PCF85063AT_WEEKDAY_ALARM))
+            {
+                g_Sim.alarmMatch = Sim_AlarmMatches();
+            }
+            break;
+    }
+
+    Sim_UpdateIntb(false);
+}
+
+/* Read a register as the bus sees it, a running countdown timer returns its current value. */
+static uint8_t Sim_ReadRegister(uint8_t offset)
+{
+    if (offset >= PCF85063AT_SIM_REG_COUNT)
+    {
+        return 0;
+    }
+    if ((offset == PCF85063AT_TIMER_VALUE) && (g_Sim.reg[PCF85063AT_TIMER_MODE] & PCF85063AT_SECONDS_TE_MASK))
+    {
+        return g_Sim.countdown;
+    }
+
+    return g_Sim.reg[offset];
+}
+
+/* Finish the DMA of the transfer in flight and signal its end to the driver which started it. */
+static void Sim_Signal(uint32_t event)
+{
+    ARM_I2C_SignalEvent_t cbEvent = g_Sim.dmaActive ? g_Sim.cbEventDma : g_Sim.cbEvent;
+    uint32_t i;
+
+    /*! The DMA owns the caller's buffers until here, like on the target. */
+    if (g_Sim.pDmaTx)
+    {
+        for (i = 1; i < g_Sim.dataCount; i++)
+        {
+            Sim_WriteRegister(g_Sim.pointer, g_Sim.pDmaTx[i]);
+            g_Sim.pointer = (g_Sim.pointer + 1) % PCF85063AT_SIM_REG_COUNT;
+        }
+    }
+    if (g_Sim.pDmaRx)
+    {
+        memcpy(g_Sim.pDmaRx, g_Sim.dmaRx, g_Sim.dataCount);
+    }
+    g_Sim.pDmaTx = NULL;
+    g_Sim.pDmaRx = NULL;
+    g_Sim.dmaActive = false;
+
+    if (cbEvent)
+    {
+        cbEvent(event);
+    }
+}
+
+/* Signal the end of a transfer now, or when the virtual clock gets there. */
+static void Sim_Complete(uint32_t event, uint32_t bytes)
+{
+    uint64_t wireNs = (uint64_t)(bytes * 9 + SIM_START_STOP_BITS) * 1000000000U / g_Sim.busSpeedHz;
+
+    g_Sim.stats.busTimeNs += wireNs;
+    /*! The interrupt driver is interrupted for every byte, the DMA driver once at the end. */
+    g_Sim.stats.interrupts += g_Sim.dmaActive ? 1U : bytes;
+    if (g_Sim.completion == PCF85063AT_SIM_COMPLETE_DEFERRED)
+    {
+        g_Sim.busy = true;
+        g_Sim.busyUntilNs = g_Sim.nowNs + wireNs;
+        g_Sim.pendingEvent = event;
+        return;
+    }
+
+    Sim_AdvanceClock(wireNs);
+    Sim_Signal(event);
+}
+
+/* Check the address and the injected faults, return the event of a failed transfer or 0. */
+static uint32_t Sim_Address(uint32_t addr)
+{
+    if (g_Sim.faultCount)
+    {
+        g_Sim.faultCount--;
+        g_Sim.stats.nacks++;
+        return g_Sim.faultEvent;
+    }
+    if ((addr & ~ARM_I2C_ADDRESS_10BIT) != PCF85063AT_SIM_I2C_ADDR)
+    {
+        g_Sim.stats.nacks++;
+        return ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE | ARM_I2C_EVENT_ADDRESS_NACK;
+    }
+    return 0;
+}
+
+static ARM_DRIVER_VERSION Sim_GetVersion(void)
+{
+    ARM_DRIVER_VERSION version = {ARM_I2C_API_VERSION, ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)};
+
+    return version;
+}
+
+static ARM_I2C_CAPABILITIES Sim_GetCapabilities(void)
+{
+    ARM_I2C_CAPABILITIES capabilities = {0};
+
+    return capabilities;
+}
+
+static int32_t Sim_Initialize(ARM_I2C_SignalEvent_t cb_event)
+{
+    g_Sim.cbEvent = cb_event;
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t Sim_Uninitialize(void)
+{
+    g_Sim.cbEvent = NULL;
+
+    return ARM_DRIVER_OK;
+}
+
+/* Drop the transfer in flight without an event. */
+static void Sim_Abort(void)
+{
+    g_Sim.busy = false;
+    g_Sim.hung = false;
+    g_Sim.dmaActive = false;
+    g_Sim.pDmaTx = NULL;
+    g_Sim.pDmaRx = NULL;
+}
+
+/* Clock one SCL pulse, the device held SDA low for as many pulses as set by PCF85063AT_Sim_SetBusStuck(). */
+static void Sim_SclPulse(void)
+{
+    g_Sim.stats.sclPulses++;
+    if (g_Sim.stuckClocks)
+    {
+        g_Sim.stuckClocks--;
+    }
+}
+
+static int32_t Sim_PowerControl(ARM_POWER_STATE state)
+{
+    if (state == ARM_POWER_OFF)
+    {
+        Sim_Abort();
+    }
+    else if (state == ARM_POWER_FULL)
+    {
+        g_Sim.stats.reinits++;
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+/* Start a transfer on a bus whose SDA is held low: it never ends. */
+static bool Sim_Hang(void)
+{
+    if (g_Sim.stuckClocks == 0)
+    {
+        return false;
+    }
+    g_Sim.hung = true;
+    g_Sim.stats.hangs++;
+
+    return true;
+}
+
+static int32_t Sim_Transmit(bool dma, uint32_t addr, const uint8_t *data, uint32_t num)
+{
+    uint32_t event, i;
+
+    if ((data == NULL) || (num == 0))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    if (g_Sim.busy || g_Sim.hung)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+    if (Sim_Hang())
+    {
+        return ARM_DRIVER_OK;
+    }
+
+    g_Sim.dmaActive = dma;
+    g_Sim.dataCount = 0;
+    event = Sim_Address(addr);
+    if (event)
+    {
+        Sim_Complete(event, 1);
+        return ARM_DRIVER_OK;
+    }
+
+    /*! The first byte is the register address, the device does not acknowledge an address out of the map. */
+    if (data[0] >= PCF85063AT_SIM_REG_COUNT)
+    {
+        g_Sim.stats.nacks++;
+        Sim_Complete(ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE, 2);
+        return ARM_DRIVER_OK;
+    }
+    g_Sim.pointer = data[0];
+    g_Sim.dataCount = num;
+    if (dma && (g_Sim.completion == PCF85063AT_SIM_COMPLETE_DEFERRED))
+    {
+        g_Sim.pDmaTx = data;
+    }
+    else
+    {
+        for (i = 1; i < num; i++)
+        {
+            Sim_WriteRegister(g_Sim.pointer, data[i]);
+            g_Sim.pointer = (g_Sim.pointer + 1) % PCF85063AT_SIM_REG_COUNT;
+        }
+    }
+
+    g_Sim.stats.transmits++;
+    g_Sim.stats.bytesWritten += num;
+    Sim_Complete(ARM_I2C_EVENT_TRANSFER_DONE, num + 1);
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t Sim_Receive(bool dma, uint32_t addr, uint8_t *data, uint32_t num)
+{
+    uint32_t event, i;
+    uint8_t *pLatch = data;
+
+    if ((data == NULL) || (num == 0) || (dma && (num > SIM_DMA_BUFFER_SIZE)))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    if (g_Sim.busy || g_Sim.hung)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+    if (Sim_Hang())
+    {
+        return ARM_DRIVER_OK;
+    }
+
+    g_Sim.dmaActive = dma;
+    g_Sim.dataCount = 0;
+    event = Sim_Address(addr);
+    if (event)
+    {
+        Sim_Complete(event, 1);
+        return ARM_DRIVER_OK;
+    }
+
+    /*! The registers are latched at the start of the read, the clock moves once it is over. */
+    if (dma && (g_Sim.completion == PCF85063AT_SIM_COMPLETE_DEFERRED))
+    {
+        pLatch = g_Sim.dmaRx;
+        g_Sim.pDmaRx = data;
+    }
+    for (i = 0; i < num; i++)
+    {
+        pLatch[i] = Sim_ReadRegister(g_Sim.pointer);
+        g_Sim.pointer = (g_Sim.pointer + 1) % PCF85063AT_SIM_REG_COUNT;
+    }
+
+    g_Sim.dataCount = num;
+    g_Sim.stats.receives++;
+    g_Sim.stats.bytesRead += num;
+    Sim_Complete(ARM_I2C_EVENT_TRANSFER_DONE, num + 1);
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t Sim_MasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num, bool xfer_pending)
+{
+    (void)xfer_pending;
+
+    return Sim_Transmit(false, addr, data, num);
+}
+
+static int32_t Sim_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num, bool xfer_pending)
+{
+    (void)xfer_pending;
+
+    return Sim_Receive(false, addr, data, num);
+}
+
+static int32_t Sim_DmaInitialize(ARM_I2C_SignalEvent_t cb_event)
+{
+    g_Sim.cbEventDma = cb_event;
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t Sim_DmaUninitialize(void)
+{
+    g_Sim.cbEventDma = NULL;
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t Sim_DmaMasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num, bool xfer_pending)
+{
+    (void)xfer_pending;
+
+    return Sim_Transmit(true, addr, data, num);
+}
+
+static int32_t Sim_DmaMasterReceive(uint32_t addr, uint8_t *data, uint32_t num, bool xfer_pending)
+{
+    (void)xfer_pending;
+
+    return Sim_Receive(true, addr, data, num);
+}
+
+static int32_t Sim_SlaveTransmit(const uint8_t *data, uint32_t num)
+{
+    (void)data;
+    (void)num;
+
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+static int32_t Sim_SlaveReceive(uint8_t *data, uint32_t num)
+{
+    (void)data;
+    (void)num;
+
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+static int32_t Sim_GetDataCount(void)
+{
+    return (int32_t)g_Sim.dataCount;
+}
+
+static int32_t Sim_Control(uint32_t control, uint32_t arg)
+{
+    static const uint32_t busSpeedHz[] = {100000U, 100000U, 400000U, 1000000U, 3400000U};
+    uint32_t i;
+
+    switch (control)
+    {
+        case ARM_I2C_OWN_ADDRESS:
+            return ARM_DRIVER_OK;
+        case ARM_I2C_BUS_SPEED:
+            if ((arg < ARM_I2C_BUS_SPEED_STANDARD) || (arg > ARM_I2C_BUS_SPEED_HIGH))
+            {
+                return ARM_DRIVER_ERROR_UNSUPPORTED;
+            }
+            g_Sim.busSpeedHz = busSpeedHz[arg];
+            return ARM_DRIVER_OK;
+        case ARM_I2C_ABORT_TRANSFER:
+            Sim_Abort();
+            return ARM_DRIVER_OK;
+        case ARM_I2C_BUS_CLEAR:
+            for (i = 0; i < 9U; i++)
+            {
+                Sim_SclPulse();
+            }
+            if (g_Sim.cbEvent)
+            {
+                g_Sim.cbEvent(ARM_I2C_EVENT_BUS_CLEAR);
+            }
+            return ARM_DRIVER_OK;
+        default:
+            return ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+}
+
+static ARM_I2C_STATUS Sim_GetStatus(void)
+{
+    ARM_I2C_STATUS status = {0};
+
+    status.busy = g_Sim.busy || g_Sim.hung;
+    status.mode = 1;
+
+    return status;
+}
+
+ARM_DRIVER_I2C Driver_I2C_Sim = {
+    Sim_GetVersion,    Sim_GetCapabilities, Sim_Initialize,   Sim_Uninitialize,  Sim_PowerControl, Sim_MasterTransmit,
+    Sim_MasterReceive, Sim_SlaveTransmit,   Sim_SlaveReceive, Sim_GetDataCount, Sim_Control,      Sim_GetStatus,
+};
+
+ARM_DRIVER_I2C Driver_I2C_SimDma = {
+    Sim_GetVersion,       Sim_GetCapabilities, Sim_DmaInitialize, Sim_DmaUninitialize, Sim_PowerControl,
+    Sim_DmaMasterTransmit, Sim_DmaMasterReceive, Sim_SlaveTransmit, Sim_SlaveReceive,   Sim_GetDataCount,
+    Sim_Control,          Sim_GetStatus,
+};
+
+static void Sim_GpioPinInit(pinID_t aPinId, gpio_direction_t dir, void *apPinConfig, gpio_isr_handler_t aIsrHandler,
+                            void *apUserData)
+{
+    (void)aPinId;
+    (void)dir;
+    (void)apPinConfig;
+    (void)aIsrHandler;
+    (void)apUserData;
+}
+
+/* Drive a bus line, a rising SCL edge clocks the device. */
+static void Sim_GpioWritePin(pinID_t aPinId, uint8_t aValue)
+{
+    if (aPinId == PCF85063AT_SIM_SCL_PIN)
+    {
+        if (g_Sim.sclLow && aValue)
+        {
+            Sim_SclPulse();
+        }
+        g_Sim.sclLow = !aValue;
+    }
+    else if (aPinId == PCF85063AT_SIM_SDA_PIN)
+    {
+        g_Sim.sdaLow = !aValue;
+    }
+}
+
+static void Sim_GpioSetPin(pinID_t aPinId)
+{
+    Sim_GpioWritePin(aPinId, 1);
+}
+
+static void Sim_GpioClrPin(pinID_t aPinId)
+{
+    Sim_GpioWritePin(aPinId, 0);
+}
+
+/* Read a bus line, low when driven low by the master or, for SDA, held low by the device. */
+static uint32_t Sim_GpioReadPin(pinID_t aPinId)
+{
+    if (aPinId == PCF85063AT_SIM_SCL_PIN)
+    {
+        return !g_Sim.sclLow;
+    }
+    if (aPinId == PCF85063AT_SIM_SDA_PIN)
+    {
+        return !g_Sim.sdaLow && (g_Sim.stuckClocks == 0);
+    }
+
+    return 0;
+}
+
+static void Sim_GpioTogglePin(pinID_t aPinId)
+{
+    Sim_GpioWritePin(aPinId, (uint8_t)!Sim_GpioReadPin(aPinId));
+}
+
+GENERIC_DRIVER_GPIO Driver_GPIO_Sim = {
+    NULL, Sim_GpioPinInit, Sim_GpioSetPin, Sim_GpioClrPin, Sim_GpioTogglePin, Sim_GpioWritePin, Sim_GpioReadPin,
+};
+
+/*! Power the simulated device up. */
+void PCF85063AT_Sim_Init(PCF85063AT_SIM_COMPLETION completion)
+{
+    ARM_I2C_SignalEvent_t cbEvent = g_Sim.cbEvent;
+    ARM_I2C_SignalEvent_t cbEventDma = g_Sim.cbEventDma;
+
+    memset(&g_Sim, 0, sizeof(g_Sim));
+    g_Sim.cbEvent = cbEvent;
+    g_Sim.cbEventDma = cbEventDma;
+    g_Sim.completion = completion;
+    g_Sim.busSpeedHz = 100000U;
+    Sim_Reset();
+}
+
+/*! Set the handler of the INTB falling edges. */
+void PCF85063AT_Sim_SetIntbCallback(PCF85063AT_sim_intbcallback_t callback, void *pUserData)
+{
+    g_Sim.intbCallback = callback;
+    g_Sim.pIntbUserData = pUserData;
+}
+
+/*! Tell whether INTB is asserted. */
+bool PCF85063AT_Sim_GetIntb(void)
+{
+    return g_Sim.intb;
+}
+
+/*! Move the virtual clock forward, signalling the transfers which end on the way. */
+void PCF85063AT_Sim_Advance(uint64_t ns)
+{
+    uint64_t target = g_Sim.nowNs + ns;
+
+    while (g_Sim.busy && (g_Sim.busyUntilNs <= target))
+    {
+        Sim_AdvanceClock(g_Sim.busyUntilNs - g_Sim.nowNs);
+        g_Sim.busy = false;
+        /*! The handler may start the next transfer, which is picked up by the loop. */
+        Sim_Signal(g_Sim.pendingEvent);
+    }
+    Sim_AdvanceClock(target - g_Sim.nowNs);
+}
+
+/*! Idle until the next event. */
+void PCF85063AT_Sim_Idle(void)
+{
+    if (g_Sim.busy)
+    {
+        PCF85063AT_Sim_Advance(g_Sim.busyUntilNs - g_Sim.nowNs);
+        /*! A transfer chained from the handler keeps the thread asleep, the last event wakes it. */
+        if (!g_Sim.busy)
+        {
+            g_Sim.stats.wakeups++;
+            PCF85063AT_Sim_Advance(g_Sim.wakeLatencyNs);
+        }
+    }
+    else
+    {
+        PCF85063AT_Sim_Advance(1000U);
+    }
+}
+
+/*! Sleep until the next event or the next wrap of the SysTick. */
+void PCF85063AT_Sim_Sleep(void)
+{
+    uint64_t tick, wrapNs;
+
+    /*! The tick of the SysTick interrupt, in nanoseconds split to stay within 64 bits. */
+    tick = BOARD_SystickGetTicks64() + BOARD_SystickGetTicksToWrap();
+    wrapNs = (tick / PCF85063AT_SIM_CORE_CLOCK_HZ) * 1000000000U +
+             ((tick % PCF85063AT_SIM_CORE_CLOCK_HZ) * 1000000000U + PCF85063AT_SIM_CORE_CLOCK_HZ - 1U) /
+                 PCF85063AT_SIM_CORE_CLOCK_HZ;
+
+    if (g_Sim.busy && (g_Sim.busyUntilNs <= wrapNs))
+    {
+        PCF85063AT_Sim_Idle();
+    }
+    else
+    {
+        PCF85063AT_Sim_Advance(wrapNs - g_Sim.nowNs);
+    }
+}
+
+/*! Set the time the waiting thread takes to run again. */
+void PCF85063AT_Sim_SetWakeLatency(uint32_t ns)
+{
+    g_Sim.wakeLatencyNs = ns;
+}
+
+/*! Get the virtual clock. */
+uint64_t PCF85063AT_Sim_GetTimeNs(void)
+{
+    return g_Sim.nowNs;
+}
+
+/*! Set the error of the crystal. */
+void PCF85063AT_Sim_SetCrystalError(int32_t ppb)
+{
+    g_Sim.crystalPpb = ppb;
+}
+
+/*! Stop or restart the oscillator. */
+void PCF85063AT_Sim_SetOscillatorStopped(bool stopped)
+{
+    g_Sim.oscillatorStopped = stopped;
+    if (stopped)
+    {
+        g_Sim.reg[PCF85063AT_SECOND] |= PCF85063AT_OS_MASK;
+    }
+}
+
+/*! Fail the next transfers. */
+void PCF85063AT_Sim_InjectFault(uint32_t count, uint32_t event)
+{
+    g_Sim.faultCount = count;
+    g_Sim.faultEvent = event;
+}
+
+/*! Hold SDA low until SCL is clocked. */
+void PCF85063AT_Sim_SetBusStuck(uint32_t clocks)
+{
+    g_Sim.stuckClocks = clocks;
+}
+
+/*! Get a register without a bus transfer. */
+uint8_t PCF85063AT_Sim_PeekRegister(uint8_t offset)
+{
+    return (offset < PCF85063AT_SIM_REG_COUNT) ? g_Sim.reg[offset] : 0;
+}
+
+/*! Set a register without a bus transfer and without side effects. */
+void PCF85063AT_Sim_PokeRegister(uint8_t offset, uint8_t value)
+{
+    if (offset < PCF85063AT_SIM_REG_COUNT)
+    {
+        g_Sim.reg[offset] = value & s_readMask[offset];
+    }
+}
+
+/*! Get the bus counters. */
+void PCF85063AT_Sim_GetStats(PCF85063AT_simstats_t *pStats)
+{
+    if (pStats)
+    {
+        *pStats = g_Sim.stats;
+    }
+}
+
+/*! Clear the bus counters. */
+void PCF85063AT_Sim_ResetStats(void)
+{
+    memset(&g_Sim.stats, 0, sizeof(g_Sim.stats));
+}
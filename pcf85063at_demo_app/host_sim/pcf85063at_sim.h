@@ -0,0 +1,214 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_sim.h
+ * @brief The pcf85063at_sim.h file declares a register level simulation of the PCF85063AT behind the
+ *  CMSIS ARM_DRIVER_I2C interface, so that the rtc and interfaces sources run on a Linux host.
+
+    Time is virtual: it only moves when a transfer takes time on the wire, when BOARD_DELAY_ms() is called,
+    when a blocking wait spins in __NOP() or when PCF85063AT_Sim_Advance() is called. The driver sees the
+    same transfers as on the board, so transaction counts and latencies measured here carry over.
+
+    Build the driver of either project against it, e.g. from pcf85063at_demo_app:
+
+        P=frdmmcxa153_pcf85063at_demoapp
+        gcc -std=gnu99 -Ihost_sim/include -Ihost_sim -I$P/rtc -I$P/interfaces -I$P/utilities \
+            -I$P/CMSIS_driver/Include -I$P/gpio_drivers host_sim/pcf85063at_sim.c host_sim/host_board.c \
+            $P/rtc/pcf85063at_i2c_drv.c $P/interfaces/register_io_i2c.c $P/interfaces/sensor_io_i2c.c \
+            $P/interfaces/bus_io_i2c.c app.c
+
+    The include directory replaces the board HAL, the debug console and the GPIO driver. On frdmmcxn947 the
+    GPIO directory is $P/gpio_driver.
+*/
+
+#ifndef PCF85063AT_SIM_H_
+#define PCF85063AT_SIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Driver_I2C.h"
+#include "Driver_GPIO.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief The 7 bit address the simulated device answers to, other addresses are not acknowledged. */
+#define PCF85063AT_SIM_I2C_ADDR (0x51)
+
+/*! @brief Number of registers, 0x00 to 0x11. The address pointer wraps from the last one to 0x00. */
+#define PCF85063AT_SIM_REG_COUNT (0x12)
+
+/*! @brief Frequency of the simulated SysTick, see BOARD_SystickGetTicks(). */
+#define PCF85063AT_SIM_CORE_CLOCK_HZ (96000000U)
+
+/*! @brief The bus lines on Driver_GPIO_Sim, see registerBusRecovery_t. */
+#define PCF85063AT_SIM_SCL_PIN ((pinID_t)1)
+#define PCF85063AT_SIM_SDA_PIN ((pinID_t)2)
+
+/*! @brief Completion of the simulated transfers. */
+typedef enum
+{
+    PCF85063AT_SIM_COMPLETE_IMMEDIATE = 0, /* The event is signalled before MasterTransmit/MasterReceive return. */
+    PCF85063AT_SIM_COMPLETE_DEFERRED = 1,  /* The event is signalled once the virtual clock reaches the end of the
+                                              transfer, like an interrupt. */
+} PCF85063AT_SIM_COMPLETION;
+
+/*! @brief Called on every falling edge of INTB, in the context which moved the virtual clock. */
+typedef void (*PCF85063AT_sim_intbcallback_t)(void *pUserData);
+
+/*! @brief This structure defines the bus counters of the simulation. */
+typedef struct
+{
+    uint32_t transmits;    /*!< MasterTransmit calls acknowledged.*/
+    uint32_t receives;     /*!< MasterReceive calls acknowledged.*/
+    uint32_t bytesWritten; /*!< Data bytes written, register addresses included.*/
+    uint32_t bytesRead;    /*!< Data bytes read.*/
+    uint32_t nacks;        /*!< Transfers not acknowledged, wrong address or injected fault.*/
+    uint64_t busTimeNs;    /*!< Time spent on the wire.*/
+    uint32_t intbEdges;    /*!< Falling edges of INTB.*/
+    uint32_t interrupts;   /*!< Transfer interrupts, one per byte on Driver_I2C_Sim and one per transfer on
+                                Driver_I2C_SimDma.*/
+    uint32_t wakeups;      /*!< Waits in PCF85063AT_Sim_Idle() ended by a transfer event, interrupt to thread
+                                handoffs.*/
+    uint32_t hangs;        /*!< Transfers started while SDA was held low, which never end.*/
+    uint32_t sclPulses;    /*!< SCL pulses clocked on Driver_GPIO_Sim or by ARM_I2C_BUS_CLEAR.*/
+    uint32_t reinits;      /*!< PowerControl(ARM_POWER_FULL) calls.*/
+} PCF85063AT_simstats_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/*! @brief The simulated bus with the PCF85063AT on it, bytes moved by the interrupt handler. */
+extern ARM_DRIVER_I2C Driver_I2C_Sim;
+
+/*! @brief The same bus with the bytes moved by DMA, see Register_I2C_SetTransport().
+ *  @details With deferred completion, the caller's buffer is read or written when the transfer ends, so
+ *           a buffer released before the completion event is caught. */
+extern ARM_DRIVER_I2C Driver_I2C_SimDma;
+
+/*! @brief The SCL and SDA pins of the bus as GPIO, for the bus recovery. */
+extern GENERIC_DRIVER_GPIO Driver_GPIO_Sim;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+/*! @brief       Powers the simulated device up.
+ *  @details     Registers take their reset values, OS is set and the time is 2000-01-01 00:00:00, Saturday.
+ *               The virtual clock, the crystal error, the wake latency, the fault injection, the stuck bus
+ *               and the counters are cleared.
+ *  @param[in]   completion  		When transfer events are signalled.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_Init(PCF85063AT_SIM_COMPLETION completion);
+
+/*! @brief       Sets the handler of the INTB falling edges.
+ *  @param[in]   callback  			Handler, NULL for none.
+ *  @param[in]   pUserData  		Parameter passed to callback.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_SetIntbCallback(PCF85063AT_sim_intbcallback_t callback, void *pUserData);
+
+/*! @brief       Tells whether INTB is asserted (low).
+ *  @return      bool true when asserted.
+ */
+bool PCF85063AT_Sim_GetIntb(void);
+
+/*! @brief       Moves the virtual clock forward.
+ *  @details     Counts the seconds, the alarm and the countdown timer and signals the transfer events and
+ *               the INTB edges which fall due.
+ *  @param[in]   ns  				Nanoseconds.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_Advance(uint64_t ns);
+
+/*! @brief       Idles until the next event.
+ *  @details     Moves the virtual clock to the end of the transfer in flight and by the wake latency, or by 1 us
+ *               when none. Called by __NOP() on the host, so that the busy waits of the register interface make
+ *               progress.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_Idle(void);
+
+/*! @brief       Sleeps until the next event or the SysTick interrupt, whichever comes first.
+ *  @details     Same as PCF85063AT_Sim_Idle() for a transfer which ends before the SysTick interrupt, at the
+ *               wrap of its 24 bit counter or at the wake-up of BOARD_SystickSetWakeup(). Otherwise, a hung
+ *               transfer included, moves the virtual clock to the interrupt. Called by __WFI() and __WFE() on
+ *               the host.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_Sleep(void);
+
+/*! @brief       Sets the time the waiting thread takes to run again after a transfer event.
+ *  @details     Models the exit from WFI or the context switch of an RTOS. Charged by PCF85063AT_Sim_Idle() once
+ *               no transfer is in flight any more, a transfer chained from the Signal Event Handler does not
+ *               wake the thread.
+ *  @param[in]   ns  				Nanoseconds, 0 by default.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_SetWakeLatency(uint32_t ns);
+
+/*! @brief       Gets the virtual clock.
+ *  @return      uint64_t Nanoseconds since PCF85063AT_Sim_Init().
+ */
+uint64_t PCF85063AT_Sim_GetTimeNs(void);
+
+/*! @brief       Sets the error of the crystal.
+ *  @details     The clock runs fast for a positive error, the offset register corrects on top of it.
+ *  @param[in]   ppb  				Error in parts per billion.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_SetCrystalError(int32_t ppb);
+
+/*! @brief       Stops or restarts the oscillator, e.g. to simulate a loss of the supply.
+ *  @details     Stopping sets the OS flag, time and timer do not count until it is restarted.
+ *  @param[in]   stopped  			true to stop.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_SetOscillatorStopped(bool stopped);
+
+/*! @brief       Fails the next transfers.
+ *  @param[in]   count  			Number of MasterTransmit/MasterReceive calls to fail.
+ *  @param[in]   event  			Event signalled instead of ARM_I2C_EVENT_TRANSFER_DONE.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_InjectFault(uint32_t count, uint32_t event);
+
+/*! @brief       Holds SDA low, as a device does when a transfer was cut within a byte it sends.
+ *  @details     Transfers started meanwhile never end, until aborted. Each SCL pulse on Driver_GPIO_Sim or of
+ *               ARM_I2C_BUS_CLEAR shifts out one bit, SDA is released after the last one.
+ *  @param[in]   clocks  			SCL pulses until SDA is released, 0 to release it now.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_SetBusStuck(uint32_t clocks);
+
+/*! @brief       Gets a register without a bus transfer.
+ *  @param[in]   offset  			Register address.
+ *  @return      uint8_t The register as it would be read, 0 for an invalid address.
+ */
+uint8_t PCF85063AT_Sim_PeekRegister(uint8_t offset);
+
+/*! @brief       Sets a register without a bus transfer and without side effects.
+ *  @details     Unlike a bus write, does not clear flags, reset the prescaler or load the countdown timer.
+ *  @param[in]   offset  			Register address.
+ *  @param[in]   value  			Register value, unimplemented bits are dropped.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_PokeRegister(uint8_t offset, uint8_t value);
+
+/*! @brief       Gets the bus counters.
+ *  @param[out]  pStats  			Pointer to the counters.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_GetStats(PCF85063AT_simstats_t *pStats);
+
+/*! @brief       Clears the bus counters.
+ *  @return      void.
+ */
+void PCF85063AT_Sim_ResetStats(void);
+
+#endif /* PCF85063AT_SIM_H_ */
@@ -0,0 +1,263 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file pcf85063at_wheel_check_main.c
+ * @brief The pcf85063at_wheel_check_main.c file checks the timer wheel of pcf85063at_wheel.c on the host
+ *  simulation, with the countdown timer of the simulated device raising INTB.
+
+    Usage: pcf85063at_wheel_check
+
+    One-shot and periodic timers are started on each side of the level boundaries of the wheel, at 64, 4096 and
+    262144 ticks, and across the three source clocks the countdown timer is loaded with, 64 Hz, 1 Hz and 1/60 Hz.
+    The main loop moves the virtual clock and dispatches the INTB events. Each expiry is checked to come at its
+    wheel tick, a timer stopped or started from a callback to be honoured, and an unchanged countdown load to be
+    kept rather than reloaded. Timers started between expiries are checked to be placed from the countdown value:
+    to the tick on the 64 Hz source clock, within a second on the 1 Hz one, without moving the other expiries.
+    Prints "check,<expiries>,expiries" and exits with 0, or prints a FAIL line and exits with 1.
+
+    Build as in pcf85063at_sim.h, with this file as the application.
+*/
+
+/* Standard C Includes */
+#include <stdio.h>
+
+/* ISSDK Includes */
+#include "issdk_hal.h"
+#include "pcf85063at_wheel.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! The step of the main loop, in nanoseconds. */
+#define WHEEL_CHECK_STEP_NS (2000000U)
+/*! One wheel tick, in nanoseconds. */
+#define WHEEL_CHECK_TICK_NS (1000000000U / PCF85063AT_WHEEL_TICK_HZ)
+/*! The timers of the check. */
+#define WHEEL_CHECK_TIMERS (20U)
+/*! Timers started by the checks below, not by the table. */
+#define WHEEL_CHECK_FROM_CALLBACK (WHEEL_CHECK_TIMERS - 4U)
+#define WHEEL_CHECK_PLACED        (WHEEL_CHECK_TIMERS - 3U)
+#define WHEEL_CHECK_PLACED_1HZ    (WHEEL_CHECK_TIMERS - 2U)
+#define WHEEL_CHECK_PERIODIC      (WHEEL_CHECK_TIMERS - 1U)
+
+#define WHEEL_CHECK(cond)                                                      \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            printf("FAIL,%s:%d,%s\n", __FILE__, __LINE__, #cond);             \
+            return 1;                                                          \
+        }                                                                      \
+    } while (0)
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t ticks;  /* Ticks to the first expiry. */
+    uint32_t period; /* Ticks between expiries, 0 for a one-shot timer. */
+    uint32_t start;  /* Wheel tick the timer counts from. */
+    uint32_t first;  /* Lowest tick of the first expiry, the wheel tick when exact. */
+    uint32_t last;   /* Highest tick of the first expiry. */
+    uint32_t fires;  /* Expiries so far. */
+    uint32_t firedAt; /* Wheel tick of the first expiry. */
+    PCF85063AT_swtimer_t timer;
+} wheelCheckTimer_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static PCF85063AT_sensorhandle_t g_Rtc;
+static PCF85063AT_eventdispatcher_t g_Events;
+static PCF85063AT_timerwheel_t g_Wheel;
+static wheelCheckTimer_t g_Timer[WHEEL_CHECK_TIMERS];
+
+/*! One-shot and periodic timers started at wheel tick 0: {ticks, period}. */
+static const uint32_t g_Table[][2] = {
+    {1, 0},          /* 64 Hz: stops timer 8 and starts WHEEL_CHECK_FROM_CALLBACK. */
+    {63, 0},     {64, 0},     {65, 0},      /* Level 0 to 1. */
+    {100, 255},                             /* 64 Hz, periodic. */
+    {256, 0},                               /* 1 Hz. */
+    {4095, 0},   {4096, 0},   {4097, 0},    /* Level 1 to 2, 4096 stopped. */
+    {16320, 16321},                         /* 1 Hz, then 1/60 Hz periodic. */
+    {262143, 0}, {262144, 0}, {262145, 0},  /* Level 2 to 3, 1/60 Hz. */
+    {300000, 0},
+};
+#define WHEEL_CHECK_TABLE (sizeof(g_Table) / sizeof(g_Table[0]))
+/*! The timer of g_Table stopped by the first expiry. */
+#define WHEEL_CHECK_STOPPED (7U)
+
+/*! Set by the callbacks, which cannot return a failure. */
+static uint32_t g_Failures;
+static uint32_t g_Expiries;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void Wheel_Callback(PCF85063AT_swtimer_t *pTimer, void *pUserData)
+{
+    uint32_t index = (uint32_t)(uintptr_t)pUserData;
+    wheelCheckTimer_t *pCheck = &g_Timer[index];
+    uint32_t offset = g_Wheel.now - pCheck->firedAt;
+
+    (void)pTimer;
+    if (pCheck->fires == 0)
+    {
+        pCheck->firedAt = g_Wheel.now;
+        if ((int32_t)(g_Wheel.now - pCheck->first) < 0 || (int32_t)(g_Wheel.now - pCheck->last) > 0)
+        {
+            printf("FAIL,timer %u,first expiry at tick %u, expected %u to %u\n", (unsigned)index,
+                   (unsigned)g_Wheel.now, (unsigned)pCheck->first, (unsigned)pCheck->last);
+            g_Failures++;
+        }
+    }
+    else if ((pCheck->period == 0) || (offset != pCheck->fires * pCheck->period))
+    {
+        printf("FAIL,timer %u,expiry %u at tick %u\n", (unsigned)index, (unsigned)pCheck->fires,
+               (unsigned)g_Wheel.now);
+        g_Failures++;
+    }
+    pCheck->fires++;
+    g_Expiries++;
+
+    /*! The first expiry stops a timer and starts one, both honoured from within a callback. */
+    if (index == 0)
+    {
+        (void)PCF85063AT_Wheel_Stop(&g_Wheel, &g_Timer[WHEEL_CHECK_STOPPED].timer);
+        pCheck = &g_Timer[WHEEL_CHECK_FROM_CALLBACK];
+        pCheck->ticks = 10;
+        pCheck->first = pCheck->last = g_Wheel.now + 10U;
+        if (PCF85063AT_Wheel_Start(&g_Wheel, &pCheck->timer, 10, 0, Wheel_Callback,
+                                   (void *)(uintptr_t)WHEEL_CHECK_FROM_CALLBACK) != SENSOR_ERROR_NONE)
+        {
+            g_Failures++;
+        }
+    }
+}
+
+static void Wheel_Intb(void *pUserData)
+{
+    (void)pUserData;
+    PCF85063AT_Event_OnInterrupt(&g_Events);
+}
+
+/* Start timer index for ticks and period, its first expiry expected between first and last. */
+static int32_t Wheel_Start(uint32_t index, uint32_t ticks, uint32_t period, uint32_t first, uint32_t last)
+{
+    wheelCheckTimer_t *pCheck = &g_Timer[index];
+
+    pCheck->ticks = ticks;
+    pCheck->period = period;
+    pCheck->first = first;
+    pCheck->last = last;
+    pCheck->fires = 0;
+
+    return PCF85063AT_Wheel_Start(&g_Wheel, &pCheck->timer, ticks, period, Wheel_Callback,
+                                  (void *)(uintptr_t)index);
+}
+
+/* Move the virtual clock, dispatching the INTB events, until the wheel reaches tick. */
+static int Wheel_RunTo(uint32_t tick)
+{
+    uint64_t steps;
+    /*! Twice the time to the tick, the countdown timer loads are late by one step at most. */
+    uint64_t maxSteps = 2U * ((uint64_t)(tick - g_Wheel.now) * WHEEL_CHECK_TICK_NS / WHEEL_CHECK_STEP_NS) + 100U;
+
+    for (steps = 0; (int32_t)(g_Wheel.now - tick) < 0; steps++)
+    {
+        WHEEL_CHECK(steps < maxSteps);
+        PCF85063AT_Sim_Advance(WHEEL_CHECK_STEP_NS);
+        WHEEL_CHECK(PCF85063AT_Event_Process(&g_Events, false) == SENSOR_ERROR_NONE);
+        WHEEL_CHECK(g_Wheel.lastStatus == SENSOR_ERROR_NONE);
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    wheelCheckTimer_t *pCheck;
+    uint32_t i, start, loads, expiries;
+
+    PCF85063AT_Sim_Init(PCF85063AT_SIM_COMPLETE_IMMEDIATE);
+    WHEEL_CHECK(Register_I2C_Initialize(&I2C_S_DRIVER, I2C_S_DEVICE_INDEX, NULL) == ARM_DRIVER_OK);
+    WHEEL_CHECK(I2C_S_DRIVER.PowerControl(ARM_POWER_FULL) == ARM_DRIVER_OK);
+    WHEEL_CHECK(PCF85063AT_Initialize(&g_Rtc, &I2C_S_DRIVER, I2C_S_DEVICE_INDEX, PCF85063AT_I2C_ADDR) ==
+                SENSOR_ERROR_NONE);
+    WHEEL_CHECK(PCF85063AT_SetEpoch(&g_Rtc, PCF85063AT_EPOCH_2000 + 86400U) == SENSOR_ERROR_NONE);
+    WHEEL_CHECK(PCF85063AT_Event_Init(&g_Events, &g_Rtc) == SENSOR_ERROR_NONE);
+    WHEEL_CHECK(PCF85063AT_Event_Register(&g_Events, PCF85063AT_EVENT_TIMER, PCF85063AT_Wheel_OnEvent, &g_Wheel) ==
+                SENSOR_ERROR_NONE);
+    PCF85063AT_Sim_SetIntbCallback(Wheel_Intb, NULL);
+    WHEEL_CHECK(PCF85063AT_Wheel_Init(&g_Wheel, &g_Rtc) == SENSOR_ERROR_NONE);
+
+    /*! The table, started at tick 0 within the second the wheel is anchored on. */
+    for (i = 0; i < WHEEL_CHECK_TABLE; i++)
+    {
+        WHEEL_CHECK(Wheel_Start(i, g_Table[i][0], g_Table[i][1], g_Table[i][0], g_Table[i][0]) ==
+                    SENSOR_ERROR_NONE);
+    }
+    WHEEL_CHECK(g_Wheel.count == WHEEL_CHECK_TABLE);
+    WHEEL_CHECK(Wheel_RunTo(300000U) == 0);
+    WHEEL_CHECK(g_Failures == 0);
+    for (i = 0; i < WHEEL_CHECK_TABLE; i++)
+    {
+        pCheck = &g_Timer[i];
+        if (i == WHEEL_CHECK_STOPPED)
+        {
+            WHEEL_CHECK(pCheck->fires == 0 && !PCF85063AT_Wheel_IsRunning(&pCheck->timer));
+        }
+        else if (pCheck->period == 0)
+        {
+            WHEEL_CHECK(pCheck->fires == 1 && !PCF85063AT_Wheel_IsRunning(&pCheck->timer));
+        }
+        else
+        {
+            WHEEL_CHECK(pCheck->fires == (300000U - pCheck->ticks) / pCheck->period + 1U);
+            WHEEL_CHECK(PCF85063AT_Wheel_Stop(&g_Wheel, &pCheck->timer) == SENSOR_ERROR_NONE);
+        }
+    }
+    WHEEL_CHECK(g_Timer[WHEEL_CHECK_FROM_CALLBACK].fires == 1);
+    WHEEL_CHECK(g_Wheel.count == 0 && g_Wheel.programmed == 0);
+
+    /*! Placement: 50.5 ticks into a 64 Hz load of 200 ticks, a timer of 30 ticks expires 80 ticks after its
+     *  start and the periodic timer keeps its expiries. */
+    start = g_Wheel.now;
+    WHEEL_CHECK(Wheel_Start(WHEEL_CHECK_PERIODIC, 200, 200, start + 200U, start + 200U) == SENSOR_ERROR_NONE);
+    WHEEL_CHECK(g_Wheel.now == start && g_Wheel.programmed == 200U);
+    PCF85063AT_Sim_Advance(50U * WHEEL_CHECK_TICK_NS + WHEEL_CHECK_TICK_NS / 2U);
+    WHEEL_CHECK(Wheel_Start(WHEEL_CHECK_PLACED, 30, 0, start + 80U, start + 80U) == SENSOR_ERROR_NONE);
+    WHEEL_CHECK(Wheel_RunTo(start + 200U) == 0);
+    WHEEL_CHECK(g_Timer[WHEEL_CHECK_PLACED].fires == 1 && g_Timer[WHEEL_CHECK_PERIODIC].fires == 1);
+
+    /*! Reload reuse: alone, the periodic timer expires on the load it leaves running. */
+    WHEEL_CHECK(Wheel_RunTo(start + 400U) == 0);
+    loads = g_Wheel.loads;
+    expiries = g_Wheel.expiries;
+    WHEEL_CHECK(Wheel_RunTo(start + 1000U) == 0);
+    WHEEL_CHECK(g_Wheel.loads == loads && g_Wheel.expiries == expiries + 3U);
+    WHEEL_CHECK(g_Timer[WHEEL_CHECK_PERIODIC].fires == 5);
+    WHEEL_CHECK(PCF85063AT_Wheel_Stop(&g_Wheel, &g_Timer[WHEEL_CHECK_PERIODIC].timer) == SENSOR_ERROR_NONE);
+
+    /*! Placement on the 1 Hz source clock: 10.3 s into a load of 31 s, within the second under way. */
+    start = g_Wheel.now;
+    WHEEL_CHECK(Wheel_Start(WHEEL_CHECK_PERIODIC, 2000, 0, start + 2000U, start + 2000U) == SENSOR_ERROR_NONE);
+    WHEEL_CHECK(g_Wheel.programmed == 31U * PCF85063AT_WHEEL_TICK_HZ);
+    PCF85063AT_Sim_Advance(10300000000ULL);
+    WHEEL_CHECK(Wheel_Start(WHEEL_CHECK_PLACED_1HZ, 100, 0, start + 640U + 100U, start + 704U + 100U) ==
+                SENSOR_ERROR_NONE);
+    WHEEL_CHECK(Wheel_RunTo(start + 2000U) == 0);
+    WHEEL_CHECK(g_Timer[WHEEL_CHECK_PLACED_1HZ].fires == 1 && g_Timer[WHEEL_CHECK_PERIODIC].fires == 1);
+    WHEEL_CHECK(g_Wheel.count == 0);
+
+    WHEEL_CHECK(g_Failures == 0);
+    printf("check,%u,expiries\n", (unsigned)g_Expiries);
+
+    return 0;
+}